@@ -27,6 +27,8 @@
 
 #include "src/ast/ast-value-factory.h"
 
+#include <vector>
+
 #include "src/api.h"
 #include "src/char-predicates-inl.h"
 #include "src/objects-inl.h"
@@ -263,12 +265,33 @@ AstConsString* AstValueFactory::NewConsString(const AstRawString* str1,
 
 void AstValueFactory::Internalize(Isolate* isolate) {
   // Strings need to be internalized before values, because values refer to
-  // strings.
+  // strings. Strings the string table already contains are looked up first,
+  // so that the table grows at most once, and only for the new ones, instead
+  // of possibly shrinking and growing while they are added.
+  std::vector<AstRawString*> new_strings;
   for (AstRawString* current = strings_; current != nullptr;) {
     AstRawString* next = current->next();
-    current->Internalize(isolate);
+    if (current->IsEmpty()) {
+      current->set_string(isolate->factory()->empty_string());
+    } else {
+      AstRawStringInternalizationKey key(current);
+      Handle<String> string;
+      if (StringTable::LookupKeyIfExists(isolate, &key).ToHandle(&string)) {
+        current->set_string(string);
+      } else {
+        new_strings.push_back(current);
+      }
+    }
     current = next;
   }
+  if (!new_strings.empty()) {
+    StringTable::EnsureCapacityForBulkInsertion(
+        isolate, static_cast<int>(new_strings.size()));
+    for (AstRawString* current : new_strings) {
+      AstRawStringInternalizationKey key(current);
+      current->set_string(StringTable::AddKeyNoResize(isolate, &key));
+    }
+  }
 
   // AstConsStrings refer to AstRawStrings.
   for (AstConsString* current = cons_strings_; current != nullptr;) {
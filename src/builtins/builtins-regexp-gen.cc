@@ -464,8 +464,9 @@ Node* RegExpBuiltinsAssembler::RegExpExecInternal(Node* const context,
   }
 
   // Check that the irregexp code has been generated for the actual string
-  // encoding. If it has, the field contains a code object; and otherwise it
-  // contains the uninitialized sentinel as a smi.
+  // encoding. If it has, the field contains a code object, or a byte array if
+  // the regexp is still interpreted; and otherwise it contains the
+  // uninitialized sentinel as a smi.
 
   Node* const code = var_code.value();
   CSA_ASSERT_BRANCH(this, [=](Label* ok, Label* not_ok) {
@@ -474,7 +475,8 @@ Node* RegExpBuiltinsAssembler::RegExpExecInternal(Node* const context,
            not_ok);
   });
   GotoIf(TaggedIsSmi(code), &runtime);
-  CSA_ASSERT(this, HasInstanceType(code, CODE_TYPE));
+  // Bytecode is executed by the interpreter in the runtime.
+  GotoIfNot(HasInstanceType(code, CODE_TYPE), &runtime);
 
   Label if_success(this), if_exception(this, Label::kDeferred);
   {
@@ -556,9 +558,14 @@ Node* RegExpBuiltinsAssembler::RegExpExecInternal(Node* const context,
                        IntPtrConstant(NativeRegExpMacroAssembler::EXCEPTION)),
            &if_exception);
 
-    CSA_ASSERT(this,
-               IntPtrEqual(int_result,
-                           IntPtrConstant(NativeRegExpMacroAssembler::RETRY)));
+    CSA_ASSERT(
+        this,
+        Word32Or(
+            IntPtrEqual(int_result,
+                        IntPtrConstant(NativeRegExpMacroAssembler::RETRY)),
+            IntPtrEqual(int_result,
+                        IntPtrConstant(
+                            NativeRegExpMacroAssembler::FALLBACK_TO_NFA))));
     Goto(&runtime);
   }
 
@@ -1103,6 +1110,7 @@ Node* RegExpBuiltinsAssembler::FlagsGetter(Node* const context,
     CASE_FOR_FLAG(JSRegExp::kDotAll);
     CASE_FOR_FLAG(JSRegExp::kUnicode);
     CASE_FOR_FLAG(JSRegExp::kSticky);
+    CASE_FOR_FLAG(JSRegExp::kLinear);
 #undef CASE_FOR_FLAG
   } else {
     DCHECK(!is_fastpath);
@@ -1160,6 +1168,7 @@ Node* RegExpBuiltinsAssembler::FlagsGetter(Node* const context,
     CASE_FOR_FLAG(JSRegExp::kDotAll, 's');
     CASE_FOR_FLAG(JSRegExp::kUnicode, 'u');
     CASE_FOR_FLAG(JSRegExp::kSticky, 'y');
+    CASE_FOR_FLAG(JSRegExp::kLinear, 'l');
 #undef CASE_FOR_FLAG
 
     return result;
@@ -16,6 +16,7 @@ namespace internal {
 
 // The number of generations for each sub cache.
 static const int kRegExpGenerations = 2;
+static const int kRegExpPersistentGenerations = 2;
 
 // Initial size of each compilation cache table allocated.
 static const int kInitialCacheSize = 64;
@@ -26,6 +27,7 @@ CompilationCache::CompilationCache(Isolate* isolate)
       eval_global_(isolate),
       eval_contextual_(isolate),
       reg_exp_(isolate, kRegExpGenerations),
+      reg_exp_persistent_(isolate, kRegExpPersistentGenerations),
       enabled_(true) {
   CompilationSubCache* subcaches[kSubCacheCount] =
     {&script_, &eval_global_, &eval_contextual_, &reg_exp_};
@@ -212,9 +214,9 @@ void CompilationCacheEval::Put(Handle<String> source,
   SetFirstTable(table);
 }
 
-MaybeHandle<FixedArray> CompilationCacheRegExp::Lookup(
-    Handle<String> source,
-    JSRegExp::Flags flags) {
+MaybeHandle<FixedArray> CompilationCacheRegExp::Lookup(Handle<String> source,
+                                                       JSRegExp::Flags flags,
+                                                       bool* survived_aging) {
   HandleScope scope(isolate());
   // Make sure not to leak the table into the surrounding handle
   // scope. Otherwise, we risk keeping old tables around even after
@@ -230,6 +232,7 @@ MaybeHandle<FixedArray> CompilationCacheRegExp::Lookup(
     Handle<FixedArray> data = Handle<FixedArray>::cast(result);
     if (generation != 0) {
       Put(source, flags, data);
+      *survived_aging = true;
     }
     isolate()->counters()->compilation_cache_hits()->Increment();
     return scope.CloseAndEscape(data);
@@ -247,6 +250,39 @@ void CompilationCacheRegExp::Put(Handle<String> source,
   SetFirstTable(CompilationCacheTable::PutRegExp(table, source, flags, data));
 }
 
+MaybeHandle<FixedArray> CompilationCacheRegExpPersistent::Lookup(
+    Handle<String> source, JSRegExp::Flags flags) {
+  HandleScope scope(isolate());
+  Handle<Object> result = isolate()->factory()->undefined_value();
+  int generation;
+  for (generation = 0; generation < generations(); generation++) {
+    Handle<CompilationCacheTable> table = GetTable(generation);
+    result = table->LookupRegExp(source, flags);
+    if (result->IsFixedArray()) break;
+  }
+  if (!result->IsFixedArray()) return MaybeHandle<FixedArray>();
+  Handle<FixedArray> data = Handle<FixedArray>::cast(result);
+  // Entries used since the last eviction live in the first generation.
+  if (generation != 0) Put(source, flags, data);
+  isolate()->counters()->compilation_cache_hits()->Increment();
+  return scope.CloseAndEscape(data);
+}
+
+void CompilationCacheRegExpPersistent::Put(Handle<String> source,
+                                           JSRegExp::Flags flags,
+                                           Handle<FixedArray> data) {
+  if (FLAG_regexp_persistent_cache_size <= 0) return;
+  HandleScope scope(isolate());
+  // Each generation holds up to half of the entries. Once the first one is
+  // full, the entries that have not been used since the previous eviction
+  // are dropped, which approximates evicting the least recently used half.
+  int generation_size =
+      std::max(1, FLAG_regexp_persistent_cache_size / generations());
+  if (GetFirstTable()->NumberOfElements() >= generation_size) Age();
+  SetFirstTable(CompilationCacheTable::PutRegExp(GetFirstTable(), source,
+                                                 flags, data));
+}
+
 void CompilationCache::Remove(Handle<SharedFunctionInfo> function_info) {
   if (!IsEnabled()) return;
 
@@ -290,7 +326,18 @@ MaybeHandle<FixedArray> CompilationCache::LookupRegExp(Handle<String> source,
                                                        JSRegExp::Flags flags) {
   if (!IsEnabled()) return MaybeHandle<FixedArray>();
 
-  return reg_exp_.Lookup(source, flags);
+  MaybeHandle<FixedArray> result = reg_exp_persistent_.Lookup(source, flags);
+  if (!result.is_null()) return result;
+
+  // Regexps that are still in use after a garbage collection are likely to
+  // stay in use, so they are moved to the cache that is not aged.
+  bool survived_aging = false;
+  result = reg_exp_.Lookup(source, flags, &survived_aging);
+  Handle<FixedArray> data;
+  if (survived_aging && result.ToHandle(&data)) {
+    reg_exp_persistent_.Put(source, flags, data);
+  }
+  return result;
 }
 
 void CompilationCache::PutScript(Handle<String> source, Handle<Context> context,
@@ -335,12 +382,14 @@ void CompilationCache::Clear() {
   for (int i = 0; i < kSubCacheCount; i++) {
     subcaches_[i]->Clear();
   }
+  reg_exp_persistent_.Clear();
 }
 
 void CompilationCache::Iterate(RootVisitor* v) {
   for (int i = 0; i < kSubCacheCount; i++) {
     subcaches_[i]->Iterate(v);
   }
+  reg_exp_persistent_.Iterate(v);
 }
 
 void CompilationCache::MarkCompactPrologue() {
@@ -349,6 +398,10 @@ void CompilationCache::MarkCompactPrologue() {
   }
 }
 
+void CompilationCache::MarkContextDisposed() {
+  reg_exp_persistent_.Age();
+}
+
 void CompilationCache::Enable() {
   enabled_ = true;
 }
@@ -137,7 +137,10 @@ class CompilationCacheRegExp: public CompilationSubCache {
   CompilationCacheRegExp(Isolate* isolate, int generations)
       : CompilationSubCache(isolate, generations) { }
 
-  MaybeHandle<FixedArray> Lookup(Handle<String> source, JSRegExp::Flags flags);
+  // Sets |survived_aging| if the entry was found in an older generation,
+  // i.e. the regexp has been reused across garbage collections.
+  MaybeHandle<FixedArray> Lookup(Handle<String> source, JSRegExp::Flags flags,
+                                 bool* survived_aging);
 
   void Put(Handle<String> source,
            JSRegExp::Flags flags,
@@ -146,6 +149,28 @@ class CompilationCacheRegExp: public CompilationSubCache {
   DISALLOW_IMPLICIT_CONSTRUCTORS(CompilationCacheRegExp);
 };
 
+// Sub-cache for regular expressions that keep being reused across garbage
+// collections, such as validation regexps created anew in every context.
+// It is not aged by garbage collections, so their compiled code survives the
+// aging of the generational regexp cache. It holds at most
+// --regexp-persistent-cache-size entries in two generations. Lookups move
+// entries to the first generation; when that is full, or when a context is
+// disposed, the second generation is dropped, evicting the entries that were
+// not used since.
+class CompilationCacheRegExpPersistent : public CompilationSubCache {
+ public:
+  CompilationCacheRegExpPersistent(Isolate* isolate, int generations)
+      : CompilationSubCache(isolate, generations) {}
+
+  MaybeHandle<FixedArray> Lookup(Handle<String> source, JSRegExp::Flags flags);
+
+  void Put(Handle<String> source, JSRegExp::Flags flags,
+           Handle<FixedArray> data);
+
+ private:
+  DISALLOW_IMPLICIT_CONSTRUCTORS(CompilationCacheRegExpPersistent);
+};
+
 // The compilation cache keeps shared function infos for compiled
 // scripts and evals. The shared function infos are looked up using
 // the source string as the key. For regular expressions the
@@ -206,6 +231,10 @@ class CompilationCache {
   // avoid keeping them alive too long without using them.
   void MarkCompactPrologue();
 
+  // Notify the cache that a context has been disposed. This retires regexps
+  // from the persistent cache that are no longer used by any context.
+  void MarkContextDisposed();
+
   // Enable/disable compilation cache. Used by debugger to disable compilation
   // cache during debugging to make sure new scripts are always compiled.
   void Enable();
@@ -231,6 +260,8 @@ class CompilationCache {
   CompilationCacheEval eval_contextual_;
   CompilationCacheRegExp reg_exp_;
   CompilationSubCache* subcaches_[kSubCacheCount];
+  // Not one of the aged |subcaches_|.
+  CompilationCacheRegExpPersistent reg_exp_persistent_;
 
   // Current enable state of the compilation cache.
   bool enabled_;
@@ -53,6 +53,7 @@ void CompilationStatistics::RecordTotalStats(size_t source_size,
 void CompilationStatistics::BasicStats::Accumulate(const BasicStats& stats) {
   delta_ += stats.delta_;
   total_allocated_bytes_ += stats.total_allocated_bytes_;
+  total_reused_bytes_ += stats.total_reused_bytes_;
   if (stats.absolute_max_allocated_bytes_ > absolute_max_allocated_bytes_) {
     absolute_max_allocated_bytes_ = stats.absolute_max_allocated_bytes_;
     max_allocated_bytes_ = stats.max_allocated_bytes_;
@@ -77,11 +78,13 @@ static void WriteLine(std::ostream& os, bool machine_format, const char* name,
                        stats.total_allocated_bytes_);
     os << buffer;
   } else {
-    base::OS::SNPrintF(buffer, kBufferSize, "%28s %10.3f (%5.1f%%)  %10" PRIuS
-                                            " (%5.1f%%) %10" PRIuS " %10" PRIuS,
+    base::OS::SNPrintF(buffer, kBufferSize,
+                       "%28s %10.3f (%5.1f%%)  %10" PRIuS " (%5.1f%%) %10" PRIuS
+                       " %10" PRIuS " %10" PRIuS,
                        name, ms, percent, stats.total_allocated_bytes_,
                        size_percent, stats.max_allocated_bytes_,
-                       stats.absolute_max_allocated_bytes_);
+                       stats.absolute_max_allocated_bytes_,
+                       stats.total_reused_bytes_);
 
     os << buffer;
     if (stats.function_name_.size() > 0) {
@@ -103,7 +106,7 @@ static void WriteHeader(std::ostream& os) {
   os << "             Turbofan phase         Time (ms)             "
      << "          Space (bytes)             Function\n"
      << "                                                         "
-     << "  Total          Max.     Abs. max.\n";
+     << "  Total          Max.     Abs. max.     Reused\n";
   WriteFullLine(os);
 }
 
@@ -31,7 +31,8 @@ class CompilationStatistics final : public Malloced {
     BasicStats()
         : total_allocated_bytes_(0),
           max_allocated_bytes_(0),
-          absolute_max_allocated_bytes_(0) {}
+          absolute_max_allocated_bytes_(0),
+          total_reused_bytes_(0) {}
 
     void Accumulate(const BasicStats& stats);
 
@@ -39,6 +40,8 @@ class CompilationStatistics final : public Malloced {
     size_t total_allocated_bytes_;
     size_t max_allocated_bytes_;
     size_t absolute_max_allocated_bytes_;
+    // Zone segment bytes that were served from the segment pool.
+    size_t total_reused_bytes_;
     std::string function_name_;
   };
 
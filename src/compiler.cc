@@ -1075,6 +1075,11 @@ bool Compiler::Compile(Handle<SharedFunctionInfo> shared_info,
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.CompileCode");
   AggregatedHistogramTimerScope timer(isolate->counters()->compile_lazy());
 
+  if (shared_info->has_flushed_bytecode()) {
+    isolate->counters()->bytecode_flush_recompilations()->Increment();
+    shared_info->set_has_flushed_bytecode(false);
+  }
+
   // Set up parse info.
   ParseInfo parse_info(shared_info);
   parse_info.set_lazy_compile();
@@ -1970,6 +1975,15 @@ void Compiler::PostInstantiation(Handle<JSFunction> function,
   }
 
   if (shared->is_compiled() && !shared->HasAsmWasmData()) {
+    if (FLAG_lazy_feedback_allocation && shared->HasBytecodeArray() &&
+        !function->has_feedback_vector()) {
+      // Many closures are never called, so leave allocating the feedback
+      // vector to CompileLazy, just like for closures created by the
+      // FastNewClosure builtin.
+      function->set_code(
+          function->GetIsolate()->builtins()->builtin(Builtins::kCompileLazy));
+      return;
+    }
     JSFunction::EnsureFeedbackVector(function);
 
     Code* code = function->feedback_vector()->optimized_code();
@@ -0,0 +1,78 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/bounds-check-elimination.h"
+
+#include "src/compiler/all-nodes.h"
+#include "src/compiler/common-operator.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/loop-variable-optimizer.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+#define TRACE(...)                                  \
+  do {                                              \
+    if (FLAG_trace_turbo_loop) PrintF(__VA_ARGS__); \
+  } while (false)
+
+BoundsCheckElimination::BoundsCheckElimination(JSGraph* jsgraph, Zone* zone)
+    : jsgraph_(jsgraph), zone_(zone) {}
+
+void BoundsCheckElimination::Run() {
+  // Collect the bounds checks first, so that we do not bother with the
+  // (comparatively expensive) control flow analysis for graphs without any.
+  AllNodes all(zone(), jsgraph()->graph());
+  NodeVector checks(zone());
+  for (Node* node : all.reachable) {
+    if (node->opcode() == IrOpcode::kCheckBounds) checks.push_back(node);
+  }
+  if (checks.empty()) return;
+
+  LoopVariableOptimizer loop_variables(jsgraph()->graph(), jsgraph()->common(),
+                                       zone());
+  loop_variables.Run();
+  for (Node* node : checks) {
+    if (IsRedundant(&loop_variables, node)) Eliminate(node);
+  }
+}
+
+bool BoundsCheckElimination::IsRedundant(LoopVariableOptimizer* loop_variables,
+                                         Node* node) const {
+  DCHECK_EQ(IrOpcode::kCheckBounds, node->opcode());
+  Node* const index = NodeProperties::GetValueInput(node, 0);
+  Node* const length = NodeProperties::GetValueInput(node, 1);
+  Node* const control = NodeProperties::GetControlInput(node);
+
+  // The {index} must be a non-negative integer, which is what the typer
+  // figures out for the common loop variables based on the induction
+  // variable bounds; that takes care of the lower bound.
+  Type* const index_type = NodeProperties::GetType(index);
+  if (!index_type->Is(Type::Integral32OrMinusZero())) return false;
+  if (index_type->IsNone() || index_type->Min() < 0.0) return false;
+
+  // The upper bound is established by a dominating {index} < {length}
+  // comparison, for example the loop condition.
+  return loop_variables->IsKnownLessThan(control, index, length);
+}
+
+void BoundsCheckElimination::Eliminate(Node* node) {
+  TRACE("Eliminating bounds check #%d (index #%d, length #%d)\n", node->id(),
+        node->InputAt(0)->id(), node->InputAt(1)->id());
+  // Turn the {node} into a TypeGuard on the {index}, so that the uses keep
+  // seeing the narrowed type that the CheckBounds computed, but no code is
+  // generated for it.
+  Type* const type = NodeProperties::GetType(node);
+  node->RemoveInput(1);
+  NodeProperties::ChangeOp(node, jsgraph()->common()->TypeGuard(type));
+}
+
+#undef TRACE
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,52 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_BOUNDS_CHECK_ELIMINATION_H_
+#define V8_COMPILER_BOUNDS_CHECK_ELIMINATION_H_
+
+#include "src/base/compiler-specific.h"
+#include "src/globals.h"
+
+namespace v8 {
+namespace internal {
+
+class Zone;
+
+namespace compiler {
+
+// Forward declarations.
+class JSGraph;
+class LoopVariableOptimizer;
+class Node;
+
+// Eliminates CheckBounds nodes whose index is an induction variable that is
+// known to be non-negative (from its type) and known to be less than the
+// length operand of the check (from a dominating loop or branch condition).
+// This has to run on the typed graph after load elimination, so that the
+// length in the loop condition and the length in the element access are
+// represented by the same node.
+class V8_EXPORT_PRIVATE BoundsCheckElimination final {
+ public:
+  BoundsCheckElimination(JSGraph* jsgraph, Zone* zone);
+
+  void Run();
+
+ private:
+  bool IsRedundant(LoopVariableOptimizer* loop_variables, Node* node) const;
+  void Eliminate(Node* node);
+
+  JSGraph* jsgraph() const { return jsgraph_; }
+  Zone* zone() const { return zone_; }
+
+  JSGraph* const jsgraph_;
+  Zone* const zone_;
+
+  DISALLOW_COPY_AND_ASSIGN(BoundsCheckElimination);
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_BOUNDS_CHECK_ELIMINATION_H_
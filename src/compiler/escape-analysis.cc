@@ -233,6 +233,12 @@ class EscapeAnalysisTracker : public ZoneObject {
 
     void MarkForDeletion() { SetReplacement(tracker_->jsgraph_->Dead()); }
 
+    // The replacement that was computed when the current node was visited
+    // last, if any.
+    Node* PreviousReplacement() {
+      return tracker_->GetReplacementOf(current_node());
+    }
+
     ~Scope() {
       if (replacement_ != tracker_->replacements_[current_node()] ||
           vobject_ != tracker_->virtual_objects_.Get(current_node())) {
@@ -499,6 +505,13 @@ int OffsetOfFieldAccess(const Operator* op) {
   return access.offset;
 }
 
+int OffsetOfElementAt(ElementAccess const& access, int index) {
+  DCHECK_GE(ElementSizeLog2Of(access.machine_type.representation()),
+            kPointerSizeLog2);
+  return access.header_size +
+         (index << ElementSizeLog2Of(access.machine_type.representation()));
+}
+
 Maybe<int> OffsetOfElementsAccess(const Operator* op, Node* index_node) {
   DCHECK(op->opcode() == IrOpcode::kLoadElement ||
          op->opcode() == IrOpcode::kStoreElement);
@@ -508,11 +521,100 @@ Maybe<int> OffsetOfElementsAccess(const Operator* op, Node* index_node) {
   double min = index_type->Min();
   int index = static_cast<int>(min);
   if (!(index == min && index == max)) return Nothing<int>();
-  ElementAccess access = ElementAccessOf(op);
-  DCHECK_GE(ElementSizeLog2Of(access.machine_type.representation()),
-            kPointerSizeLog2);
-  return Just(access.header_size + (index << ElementSizeLog2Of(
-                                        access.machine_type.representation())));
+  return Just(OffsetOfElementAt(ElementAccessOf(op), index));
+}
+
+// The maximum number of elements a LoadElement with a non-constant index can
+// refer to, such that we still turn it into a chain of Selects.
+const int kMaxElementsForVariableIndex = 4;
+
+// Checks whether {node} is the chain of Selects that
+// ReduceLoadElementWithVariableIndex builds for the given {values}, so that
+// revisiting the LoadElement does not create new nodes every time.
+bool IsSelectChainFor(Node* node, Node* index, int min,
+                      Node* const* values, int count) {
+  for (int i = 0; i < count - 1; ++i) {
+    if (node->opcode() != IrOpcode::kSelect) return false;
+    Node* condition = node->InputAt(0);
+    if (condition->opcode() != IrOpcode::kNumberEqual ||
+        condition->InputAt(0) != index) {
+      return false;
+    }
+    NumberMatcher m(condition->InputAt(1));
+    if (!m.Is(min + i) || node->InputAt(1) != values[i]) return false;
+    node = node->InputAt(2);
+  }
+  return node == values[count - 1];
+}
+
+// A LoadElement with a non-constant {index} from a virtual object that can
+// only refer to a few elements (for example [x, f(x)][i] with i in [0,1]) is
+// turned into a chain of Selects over these elements, which still allows the
+// object to be scalar replaced. Returns false if the object has to escape
+// instead.
+bool ReduceLoadElementWithVariableIndex(const Operator* op,
+                                        const VirtualObject* vobject,
+                                        Node* index,
+                                        EscapeAnalysisTracker::Scope* current,
+                                        JSGraph* jsgraph) {
+  ElementAccess const& access = ElementAccessOf(op);
+  int const element_size_log2 =
+      ElementSizeLog2Of(access.machine_type.representation());
+  if (element_size_log2 < kPointerSizeLog2) return false;
+  int const length = (vobject->size() - access.header_size) >>
+                     element_size_log2;
+  Type* const index_type = NodeProperties::GetType(index);
+  if (length <= 0 || !index_type->Is(Type::OrderedNumber())) return false;
+  // Element accesses are bounds checked, so the {index} is in [0, length[.
+  double const min = std::max(0.0, std::ceil(index_type->Min()));
+  double const max = std::min(length - 1.0, std::floor(index_type->Max()));
+  if (min > max || max - min >= kMaxElementsForVariableIndex) return false;
+
+  int const first = static_cast<int>(min);
+  int const count = static_cast<int>(max) - first + 1;
+  Node* values[kMaxElementsForVariableIndex];
+  for (int i = 0; i < count; ++i) {
+    Variable var;
+    Node* value;
+    if (!vobject->FieldAt(OffsetOfElementAt(access, first + i)).To(&var) ||
+        !current->Get(var).To(&value)) {
+      return false;
+    }
+    // If the variable has no value, we have not reached the fixed-point
+    // yet; keep the object virtual for now.
+    if (value == nullptr) return true;
+    // The Select chain is not visited by the analysis, so it must not refer
+    // to virtual objects, and its type has to be consistent with the load.
+    if (current->GetVirtualObject(value) != nullptr) return false;
+    if (!NodeProperties::IsTyped(value) ||
+        !NodeProperties::GetType(value)->Is(access.type)) {
+      return false;
+    }
+    values[i] = value;
+  }
+
+  Node* replacement = current->PreviousReplacement();
+  if (replacement == nullptr ||
+      !IsSelectChainFor(replacement, index, first, values, count)) {
+    Graph* graph = jsgraph->graph();
+    replacement = values[count - 1];
+    for (int i = count - 2; i >= 0; --i) {
+      Node* constant = jsgraph->Constant(first + i);
+      if (!NodeProperties::IsTyped(constant)) {
+        NodeProperties::SetType(constant,
+                                Type::NewConstant(first + i, graph->zone()));
+      }
+      Node* condition = graph->NewNode(jsgraph->simplified()->NumberEqual(),
+                                       index, constant);
+      NodeProperties::SetType(condition, Type::Boolean());
+      replacement = graph->NewNode(
+          jsgraph->common()->Select(access.machine_type.representation()),
+          condition, values[i], replacement);
+      NodeProperties::SetType(replacement, access.type);
+    }
+  }
+  current->SetReplacement(replacement);
+  return true;
 }
 
 Node* LowerCompareMapsWithoutLoad(Node* checked_map,
@@ -617,6 +719,10 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
           OffsetOfElementsAccess(op, index).To(&offset) &&
           vobject->FieldAt(offset).To(&var) && current->Get(var).To(&value)) {
         current->SetReplacement(value);
+      } else if (vobject && !vobject->HasEscaped() &&
+                 ReduceLoadElementWithVariableIndex(op, vobject, index,
+                                                    current, jsgraph)) {
+        break;
       } else {
         current->SetEscaped(object);
       }
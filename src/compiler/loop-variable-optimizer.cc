@@ -159,6 +159,7 @@ void LoopVariableOptimizer::VisitIf(Node* node, bool polarity) {
   // Normalize to less than comparison.
   switch (cond->opcode()) {
     case IrOpcode::kJSLessThan:
+    case IrOpcode::kNumberLessThan:
     case IrOpcode::kSpeculativeNumberLessThan:
       AddCmpToLimits(&limits, cond, InductionVariable::kStrict, polarity);
       break;
@@ -166,6 +167,7 @@ void LoopVariableOptimizer::VisitIf(Node* node, bool polarity) {
       AddCmpToLimits(&limits, cond, InductionVariable::kNonStrict, !polarity);
       break;
     case IrOpcode::kJSLessThanOrEqual:
+    case IrOpcode::kNumberLessThanOrEqual:
     case IrOpcode::kSpeculativeNumberLessThanOrEqual:
       AddCmpToLimits(&limits, cond, InductionVariable::kNonStrict, polarity);
       break;
@@ -206,6 +208,17 @@ void LoopVariableOptimizer::VisitOtherControl(Node* node) {
   return TakeConditionsFromFirstControl(node);
 }
 
+bool LoopVariableOptimizer::IsKnownLessThan(Node* control, Node* left,
+                                            Node* right) const {
+  for (Constraint constraint : limits_.Get(control)) {
+    if (constraint.left == left && constraint.right == right &&
+        constraint.kind == InductionVariable::kStrict) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void LoopVariableOptimizer::TakeConditionsFromFirstControl(Node* node) {
   limits_.Set(node, limits_.Get(NodeProperties::GetControlInput(node, 0)));
 }
@@ -225,12 +238,18 @@ InductionVariable* LoopVariableOptimizer::TryGetInductionVariable(Node* phi) {
   DCHECK_EQ(IrOpcode::kLoop, loop->opcode());
   Node* initial = phi->InputAt(0);
   Node* arith = phi->InputAt(1);
+  // Look through the sigma that the typer may have inserted on the backedge
+  // (see ChangeToPhisAndInsertGuards), so that the analysis can be rerun on
+  // an already typed graph.
+  if (arith->opcode() == IrOpcode::kTypeGuard) arith = arith->InputAt(0);
   InductionVariable::ArithmeticType arithmeticType;
   if (arith->opcode() == IrOpcode::kJSAdd ||
+      arith->opcode() == IrOpcode::kNumberAdd ||
       arith->opcode() == IrOpcode::kSpeculativeNumberAdd ||
       arith->opcode() == IrOpcode::kSpeculativeSafeIntegerAdd) {
     arithmeticType = InductionVariable::ArithmeticType::kAddition;
   } else if (arith->opcode() == IrOpcode::kJSSubtract ||
+             arith->opcode() == IrOpcode::kNumberSubtract ||
              arith->opcode() == IrOpcode::kSpeculativeNumberSubtract ||
              arith->opcode() == IrOpcode::kSpeculativeSafeIntegerSubtract) {
     arithmeticType = InductionVariable::ArithmeticType::kSubtraction;
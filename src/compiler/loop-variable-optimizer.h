@@ -80,6 +80,11 @@ class LoopVariableOptimizer {
   void ChangeToInductionVariablePhis();
   void ChangeToPhisAndInsertGuards();
 
+  // Returns true if {left} < {right} is known to hold on all paths reaching
+  // the {control} node, i.e. if it is implied by a dominating branch. Only
+  // comparisons involving induction variables are tracked.
+  bool IsKnownLessThan(Node* control, Node* left, Node* right) const;
+
  private:
   const int kAssumedLoopEntryIndex = 0;
   const int kFirstBackedge = 1;
@@ -88,7 +88,7 @@ Node* Node::New(Zone* zone, NodeId id, const Operator* op, int input_count,
     int capacity = input_count;
     if (has_extensible_inputs) {
       const int max = kMaxInlineCapacity;
-      capacity = std::min(input_count + 3, max);
+      capacity = std::min(input_count + kExtensibleInlineSlack, max);
     }
 
     size_t size = sizeof(Node) + capacity * (sizeof(Node*) + sizeof(Use));
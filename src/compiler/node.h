@@ -283,6 +283,11 @@ class V8_EXPORT_PRIVATE Node final {
   static const int kOutlineMarker = InlineCountField::kMax;
   static const int kMaxInlineCount = InlineCountField::kMax - 1;
   static const int kMaxInlineCapacity = InlineCapacityField::kMax - 1;
+  // Number of spare inline input slots reserved for nodes with extensible
+  // inputs (loops, merges and phis while building the graph). Each slot costs
+  // an input pointer plus a {Use}; nodes that outgrow the slack move their
+  // inputs out of line.
+  static const int kExtensibleInlineSlack = 3;
 
   const Operator* op_;
   Type* type_;
@@ -41,6 +41,7 @@ void PipelineStatistics::CommonStats::End(
       diff->max_allocated_bytes_ + allocated_bytes_at_start_;
   diff->total_allocated_bytes_ =
       outer_zone_diff + scope_->GetTotalAllocatedBytes();
+  diff->total_reused_bytes_ = scope_->GetTotalReusedBytes();
   scope_.reset();
   timer_.Stop();
 }
@@ -15,6 +15,7 @@
 #include "src/bootstrapper.h"
 #include "src/compiler.h"
 #include "src/compiler/basic-block-instrumentor.h"
+#include "src/compiler/bounds-check-elimination.h"
 #include "src/compiler/branch-elimination.h"
 #include "src/compiler/bytecode-graph-builder.h"
 #include "src/compiler/checkpoint-elimination.h"
@@ -1440,6 +1441,16 @@ struct LoadEliminationPhase {
   }
 };
 
+struct BoundsCheckEliminationPhase {
+  static const char* phase_name() { return "bounds check elimination"; }
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    BoundsCheckElimination bounds_check_elimination(data->jsgraph(),
+                                                    temp_zone);
+    bounds_check_elimination.Run();
+  }
+};
+
 struct MemoryOptimizationPhase {
   static const char* phase_name() { return "memory optimization"; }
 
@@ -1901,6 +1912,11 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
     RunPrintAndVerify("Escape Analysed");
   }
 
+  if (FLAG_turbo_bounds_check_elimination) {
+    Run<BoundsCheckEliminationPhase>();
+    RunPrintAndVerify("Bounds checks eliminated");
+  }
+
   // Perform simplified lowering. This has to run w/o the Typer decorator,
   // because we cannot compute meaningful types anyways, and the computed types
   // might even conflict with the representation/truncation logic.
@@ -2328,14 +2344,23 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
               ->RangesDefinedInDeferredStayInDeferred());
   }
 
-  if (FLAG_turbo_preprocess_ranges) {
+  // Splintering the live ranges in deferred code roughly doubles the number
+  // of ranges the allocator has to process, which does not pay off for huge
+  // functions (e.g. large asm.js modules or generated code), where compile
+  // time matters more than the quality of the deferred code.
+  bool const preprocess_ranges =
+      FLAG_turbo_preprocess_ranges &&
+      data->sequence()->instructions().size() <=
+          static_cast<size_t>(FLAG_turbo_fast_regalloc_threshold);
+
+  if (preprocess_ranges) {
     Run<SplinterLiveRangesPhase>();
   }
 
   Run<AllocateGeneralRegistersPhase<LinearScanAllocator>>();
   Run<AllocateFPRegistersPhase<LinearScanAllocator>>();
 
-  if (FLAG_turbo_preprocess_ranges) {
+  if (preprocess_ranges) {
     Run<MergeSplintersPhase>();
   }
 
@@ -4,6 +4,7 @@
 
 #include "src/compiler/redundancy-elimination.h"
 
+#include "src/compiler/node-matchers.h"
 #include "src/compiler/node-properties.h"
 #include "src/compiler/simplified-operator.h"
 
@@ -134,8 +135,25 @@ RedundancyElimination::EffectPathChecks::AddCheck(Zone* zone,
 
 namespace {
 
+// Does bounds check {a} subsume bounds check {b}? This is the case if both
+// check the same index and the length checked by {a} is known to be less than
+// or equal to the length checked by {b}.
+bool CheckBoundsSubsumes(Node* a, Node* b) {
+  DCHECK_EQ(IrOpcode::kCheckBounds, a->opcode());
+  DCHECK_EQ(IrOpcode::kCheckBounds, b->opcode());
+  if (a->InputAt(0) != b->InputAt(0)) return false;
+  if (a->InputAt(1) == b->InputAt(1)) return true;
+  NumberMatcher ma(a->InputAt(1));
+  NumberMatcher mb(b->InputAt(1));
+  return ma.HasValue() && mb.HasValue() && ma.Value() <= mb.Value();
+}
+
 // Does check {a} subsume check {b}?
-bool CheckSubsumes(Node const* a, Node const* b) {
+bool CheckSubsumes(Node* a, Node* b) {
+  if (a->opcode() == IrOpcode::kCheckBounds &&
+      b->opcode() == IrOpcode::kCheckBounds) {
+    return CheckBoundsSubsumes(a, b);
+  }
   if (a->op() != b->op()) {
     if (a->opcode() == IrOpcode::kCheckInternalizedString &&
         b->opcode() == IrOpcode::kCheckString) {
@@ -144,7 +162,6 @@ bool CheckSubsumes(Node const* a, Node const* b) {
       return false;
     } else {
       switch (a->opcode()) {
-        case IrOpcode::kCheckBounds:
         case IrOpcode::kCheckSmi:
         case IrOpcode::kCheckString:
         case IrOpcode::kCheckNumber:
@@ -318,16 +318,77 @@ int InstructionScheduler::GetTargetInstructionFlags(
 }
 
 
-int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
-  // Basic latency modeling for x64 instructions. They have been determined
-  // in an empirical way.
+namespace {
+
+// Load-to-use latency of an L1 cache hit on recent Intel and AMD cores.
+const int kL1LoadLatency = 5;
+
+// Stores retire into the store buffer, nothing waits for their result.
+const int kStoreLatency = 1;
+
+bool HasMemoryOperand(const Instruction* instr) {
+  if (instr->addressing_mode() == kMode_None) return false;
   switch (instr->arch_opcode()) {
+    case kX64Lea:
+    case kX64Lea32:
+      // Address computation only, no memory access.
+      return false;
+    default:
+      return true;
+  }
+}
+
+bool IsStore(const Instruction* instr) {
+  if (!HasMemoryOperand(instr) || instr->HasOutput()) return false;
+  switch (instr->arch_opcode()) {
+    case kX64Movb:
+    case kX64Movw:
+    case kX64Movl:
+    case kX64Movq:
+    case kX64Movsd:
+    case kX64Movss:
+    case kX64Movdqu:
+      return true;
+    default:
+      return false;
+  }
+}
+
+int GetArithmeticLatency(const Instruction* instr) {
+  // Latencies of the register forms, roughly following Agner Fog's
+  // instruction tables for Haswell/Skylake and Zen. Where the cores differ
+  // we pick the slower one, so that long dependency chains are started early.
+  switch (instr->arch_opcode()) {
+    case kX64Movsxbl:
+    case kX64Movzxbl:
+    case kX64Movsxbq:
+    case kX64Movzxbq:
+    case kX64Movsxwl:
+    case kX64Movzxwl:
+    case kX64Movsxwq:
+    case kX64Movzxwq:
+    case kX64Movsxlq:
+    case kX64Movl:
+    case kX64Movq:
+    case kX64Movsd:
+    case kX64Movss:
+    case kX64Movdqu:
+      // The memory forms only pay for the load, stores are handled
+      // separately.
+      return instr->addressing_mode() == kMode_None ? 1 : 0;
     case kSSEFloat64Mul:
+    case kAVXFloat64Mul:
       return 5;
     case kX64Imul:
     case kX64Imul32:
     case kX64ImulHigh32:
     case kX64UmulHigh32:
+    case kX64Lzcnt:
+    case kX64Lzcnt32:
+    case kX64Tzcnt:
+    case kX64Tzcnt32:
+    case kX64Popcnt:
+    case kX64Popcnt32:
     case kSSEFloat32Cmp:
     case kSSEFloat32Add:
     case kSSEFloat32Sub:
@@ -338,10 +399,32 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat64Sub:
     case kSSEFloat64Max:
     case kSSEFloat64Min:
+    case kSSEFloat32Max:
+    case kSSEFloat32Min:
     case kSSEFloat64Abs:
     case kSSEFloat64Neg:
+    case kAVXFloat32Cmp:
+    case kAVXFloat32Add:
+    case kAVXFloat32Sub:
+    case kAVXFloat32Abs:
+    case kAVXFloat32Neg:
+    case kAVXFloat64Cmp:
+    case kAVXFloat64Add:
+    case kAVXFloat64Sub:
+    case kAVXFloat64Abs:
+    case kAVXFloat64Neg:
+    case kX64BitcastFI:
+    case kX64BitcastDL:
+    case kX64BitcastIF:
+    case kX64BitcastLD:
+    case kSSEFloat64ExtractLowWord32:
+    case kSSEFloat64ExtractHighWord32:
+    case kSSEFloat64InsertLowWord32:
+    case kSSEFloat64InsertHighWord32:
+    case kSSEFloat64LoadLowWord32:
       return 3;
     case kSSEFloat32Mul:
+    case kAVXFloat32Mul:
     case kSSEFloat32ToFloat64:
     case kSSEFloat64ToFloat32:
     case kSSEFloat32Round:
@@ -350,7 +433,31 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat32ToUint32:
     case kSSEFloat64ToInt32:
     case kSSEFloat64ToUint32:
+    case kSSEInt32ToFloat32:
+    case kSSEInt32ToFloat64:
+    case kSSEUint32ToFloat32:
+    case kSSEUint32ToFloat64:
+    case kX64F32x4Add:
+    case kX64F32x4Sub:
+    case kX64F32x4Mul:
+    case kX64F32x4Min:
+    case kX64F32x4Max:
+    case kX64F32x4Eq:
+    case kX64F32x4Ne:
+    case kX64F32x4Lt:
+    case kX64F32x4Le:
+    case kX64F32x4RecipApprox:
+    case kX64F32x4RecipSqrtApprox:
       return 4;
+    case kSSEInt64ToFloat32:
+    case kSSEInt64ToFloat64:
+    case kX64F32x4AddHoriz:
+    case kX64I32x4AddHoriz:
+    case kX64I16x8AddHoriz:
+    case kX64I16x8Mul:
+      return 6;
+    case kX64I32x4Mul:
+      return 10;
     case kX64Idiv:
       return 49;
     case kX64Idiv32:
@@ -361,6 +468,8 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
       return 26;
     case kSSEFloat32Div:
     case kSSEFloat64Div:
+    case kAVXFloat32Div:
+    case kAVXFloat64Div:
     case kSSEFloat32Sqrt:
     case kSSEFloat64Sqrt:
       return 13;
@@ -368,6 +477,8 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat64ToInt64:
     case kSSEFloat32ToUint64:
     case kSSEFloat64ToUint64:
+    case kSSEUint64ToFloat32:
+    case kSSEUint64ToFloat64:
       return 10;
     case kSSEFloat64Mod:
       return 50;
@@ -378,6 +489,17 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
   }
 }
 
+}  // namespace
+
+int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
+  if (IsStore(instr)) return kStoreLatency;
+  int latency = GetArithmeticLatency(instr);
+  // Everything else with a memory operand, including compares and tests
+  // without an output, first has to wait for the load.
+  if (HasMemoryOperand(instr)) latency += kL1LoadLatency;
+  return latency;
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -13,6 +13,7 @@ namespace compiler {
 ZoneStats::StatsScope::StatsScope(ZoneStats* zone_stats)
     : zone_stats_(zone_stats),
       total_allocated_bytes_at_start_(zone_stats->GetTotalAllocatedBytes()),
+      total_reused_bytes_at_start_(zone_stats->GetTotalReusedBytes()),
       max_allocated_bytes_(0) {
   zone_stats_->stats_.push_back(this);
   for (Zone* zone : zone_stats_->zones_) {
@@ -51,6 +52,10 @@ size_t ZoneStats::StatsScope::GetTotalAllocatedBytes() {
          total_allocated_bytes_at_start_;
 }
 
+size_t ZoneStats::StatsScope::GetTotalReusedBytes() {
+  return zone_stats_->GetTotalReusedBytes() - total_reused_bytes_at_start_;
+}
+
 void ZoneStats::StatsScope::ZoneReturned(Zone* zone) {
   size_t current_total = GetCurrentAllocatedBytes();
   // Update max.
@@ -63,7 +68,10 @@ void ZoneStats::StatsScope::ZoneReturned(Zone* zone) {
 }
 
 ZoneStats::ZoneStats(AccountingAllocator* allocator)
-    : max_allocated_bytes_(0), total_deleted_bytes_(0), allocator_(allocator) {}
+    : max_allocated_bytes_(0),
+      total_deleted_bytes_(0),
+      total_deleted_reused_bytes_(0),
+      allocator_(allocator) {}
 
 ZoneStats::~ZoneStats() {
   DCHECK(zones_.empty());
@@ -86,6 +94,14 @@ size_t ZoneStats::GetTotalAllocatedBytes() const {
   return total_deleted_bytes_ + GetCurrentAllocatedBytes();
 }
 
+size_t ZoneStats::GetTotalReusedBytes() const {
+  size_t total = total_deleted_reused_bytes_;
+  for (Zone* zone : zones_) {
+    total += zone->segment_bytes_reused();
+  }
+  return total;
+}
+
 Zone* ZoneStats::NewEmptyZone(const char* zone_name) {
   Zone* zone = new Zone(allocator_, zone_name);
   zones_.push_back(zone);
@@ -105,6 +121,7 @@ void ZoneStats::ReturnZone(Zone* zone) {
   DCHECK(it != zones_.end());
   zones_.erase(it);
   total_deleted_bytes_ += static_cast<size_t>(zone->allocation_size());
+  total_deleted_reused_bytes_ += zone->segment_bytes_reused();
   delete zone;
 }
 
@@ -48,6 +48,7 @@ class V8_EXPORT_PRIVATE ZoneStats final {
     size_t GetMaxAllocatedBytes();
     size_t GetCurrentAllocatedBytes();
     size_t GetTotalAllocatedBytes();
+    size_t GetTotalReusedBytes();
 
    private:
     friend class ZoneStats;
@@ -58,6 +59,7 @@ class V8_EXPORT_PRIVATE ZoneStats final {
     ZoneStats* const zone_stats_;
     InitialValues initial_values_;
     size_t total_allocated_bytes_at_start_;
+    size_t total_reused_bytes_at_start_;
     size_t max_allocated_bytes_;
 
     DISALLOW_COPY_AND_ASSIGN(StatsScope);
@@ -69,6 +71,8 @@ class V8_EXPORT_PRIVATE ZoneStats final {
   size_t GetMaxAllocatedBytes() const;
   size_t GetTotalAllocatedBytes() const;
   size_t GetCurrentAllocatedBytes() const;
+  // Segment bytes that zones obtained from the allocator's segment pool.
+  size_t GetTotalReusedBytes() const;
 
  private:
   Zone* NewEmptyZone(const char* zone_name);
@@ -82,6 +86,7 @@ class V8_EXPORT_PRIVATE ZoneStats final {
   Stats stats_;
   size_t max_allocated_bytes_;
   size_t total_deleted_bytes_;
+  size_t total_deleted_reused_bytes_;
   AccountingAllocator* allocator_;
 
   DISALLOW_COPY_AND_ASSIGN(ZoneStats);
@@ -1288,6 +1288,11 @@ class RuntimeCallTimerScope {
   SC(arguments_adaptors, V8.ArgumentsAdaptors)                      \
   SC(compilation_cache_hits, V8.CompilationCacheHits)               \
   SC(compilation_cache_misses, V8.CompilationCacheMisses)           \
+  /* Bytecode dropped by bytecode flushing. */                      \
+  SC(bytecode_arrays_flushed, V8.BytecodeArraysFlushed)             \
+  SC(bytecode_bytes_flushed, V8.BytecodeBytesFlushed)               \
+  /* Functions recompiled after their bytecode was flushed. */      \
+  SC(bytecode_flush_recompilations, V8.BytecodeFlushRecompilations) \
   /* Amount of evaled source code. */                               \
   SC(total_eval_size, V8.TotalEvalSize)                             \
   /* Amount of loaded source code. */                               \
@@ -1351,6 +1356,8 @@ class RuntimeCallTimerScope {
   SC(sub_string_native, V8.SubStringNative)                                    \
   SC(regexp_entry_runtime, V8.RegExpEntryRuntime)                              \
   SC(regexp_entry_native, V8.RegExpEntryNative)                                \
+  SC(regexp_tier_ups, V8.RegExpTierUps)                                        \
+  SC(regexp_linear_fallbacks, V8.RegExpLinearFallbacks)                        \
   SC(number_to_string_native, V8.NumberToStringNative)                         \
   SC(number_to_string_runtime, V8.NumberToStringRuntime)                       \
   SC(math_exp_runtime, V8.MathExpRuntime)                                      \
@@ -1364,6 +1371,7 @@ class RuntimeCallTimerScope {
   SC(soft_deopts_requested, V8.SoftDeoptsRequested)                            \
   SC(soft_deopts_inserted, V8.SoftDeoptsInserted)                              \
   SC(soft_deopts_executed, V8.SoftDeoptsExecuted)                              \
+  SC(deopt_loops_detected, V8.DeoptLoopsDetected)                              \
   /* Number of write barriers in generated code. */                            \
   SC(write_barriers_dynamic, V8.WriteBarriersDynamic)                          \
   SC(write_barriers_static, V8.WriteBarriersStatic)                            \
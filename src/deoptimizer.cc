@@ -389,6 +389,7 @@ Deoptimizer::Deoptimizer(Isolate* isolate, JSFunction* function,
       from_(from),
       fp_to_sp_delta_(fp_to_sp_delta),
       deoptimizing_throw_(false),
+      record_deopt_site_(false),
       catch_handler_data_(-1),
       catch_handler_pc_offset_(-1),
       input_(nullptr),
@@ -432,6 +433,13 @@ Deoptimizer::Deoptimizer(Isolate* isolate, JSFunction* function,
     } else if (function != nullptr) {
       function->feedback_vector()->increment_deopt_count();
     }
+    // Eager deopts with a known position are recorded at their bytecode
+    // site once the interpreter frames exist, see Runtime_NotifyDeoptimized.
+    // Soft deopts only signal missing feedback and are not recorded.
+    record_deopt_site_ =
+        bailout_type_ == Deoptimizer::EAGER && function != nullptr &&
+        compiled_code_->kind() == Code::OPTIMIZED_FUNCTION &&
+        GetDeoptInfo(compiled_code_, from_).position.IsKnown();
   }
   if (compiled_code_->kind() == Code::OPTIMIZED_FUNCTION) {
     compiled_code_->set_deopt_already_counted(true);
@@ -432,6 +432,10 @@ class Deoptimizer : public Malloced {
   Handle<Code> compiled_code() const;
   BailoutType bailout_type() const { return bailout_type_; }
 
+  // Whether this deopt should be recorded at its bytecode site, to detect
+  // functions that keep deoptimizing at the same place.
+  bool record_deopt_site() const { return record_deopt_site_; }
+
   // Number of created JS frames. Not all created frames are necessarily JS.
   int jsframe_count() const { return jsframe_count_; }
 
@@ -598,6 +602,7 @@ class Deoptimizer : public Malloced {
   Address from_;
   int fp_to_sp_delta_;
   bool deoptimizing_throw_;
+  bool record_deopt_site_;
   int catch_handler_data_;
   int catch_handler_pc_offset_;
 
@@ -97,6 +97,9 @@ INT32_ACCESSORS(FeedbackVector, length, kLengthOffset)
 INT32_ACCESSORS(FeedbackVector, invocation_count, kInvocationCountOffset)
 INT32_ACCESSORS(FeedbackVector, profiler_ticks, kProfilerTicksOffset)
 INT32_ACCESSORS(FeedbackVector, deopt_count, kDeoptCountOffset)
+INT32_ACCESSORS(FeedbackVector, last_deopt_site, kLastDeoptSiteOffset)
+INT32_ACCESSORS(FeedbackVector, same_site_deopt_count,
+                kSameSiteDeoptCountOffset)
 
 bool FeedbackVector::is_empty() const { return length() == 0; }
 
@@ -113,6 +116,17 @@ void FeedbackVector::increment_deopt_count() {
   }
 }
 
+int FeedbackVector::RecordDeoptSite(int site) {
+  int count = same_site_deopt_count();
+  if (count == 0 || last_deopt_site() != site) {
+    set_last_deopt_site(site);
+    count = 0;
+  }
+  if (count < std::numeric_limits<int32_t>::max()) count++;
+  set_same_site_deopt_count(count);
+  return count;
+}
+
 Code* FeedbackVector::optimized_code() const {
   MaybeObject* slot = optimized_code_weak_or_smi();
   DCHECK(slot->IsSmi() || slot->IsClearedWeakHeapObject() ||
@@ -514,6 +514,41 @@ bool FeedbackNexus::ConfigureMegamorphic(IcCheckType property_type) {
   return changed;
 }
 
+bool FeedbackNexus::Generalize() {
+  DisallowHeapAllocation no_gc;
+  Isolate* isolate = GetIsolate();
+  switch (kind()) {
+    case FeedbackSlotKind::kLoadProperty:
+    case FeedbackSlotKind::kStoreNamedSloppy:
+    case FeedbackSlotKind::kStoreNamedStrict:
+    case FeedbackSlotKind::kStoreOwnNamed:
+      ConfigureMegamorphic(PROPERTY);
+      return true;
+    case FeedbackSlotKind::kLoadKeyed:
+    case FeedbackSlotKind::kStoreKeyedSloppy:
+    case FeedbackSlotKind::kStoreKeyedStrict:
+    case FeedbackSlotKind::kStoreInArrayLiteral:
+      ConfigureMegamorphic(ELEMENT);
+      return true;
+    case FeedbackSlotKind::kCall:
+      SetFeedback(*FeedbackVector::MegamorphicSentinel(isolate),
+                  SKIP_WRITE_BARRIER);
+      SetSpeculationMode(SpeculationMode::kDisallowSpeculation);
+      return true;
+    case FeedbackSlotKind::kBinaryOp:
+      SetFeedback(Smi::FromInt(BinaryOperationFeedback::kAny));
+      return true;
+    case FeedbackSlotKind::kCompareOp:
+      SetFeedback(Smi::FromInt(CompareOperationFeedback::kAny));
+      return true;
+    case FeedbackSlotKind::kForIn:
+      SetFeedback(Smi::FromInt(ForInFeedback::kAny));
+      return true;
+    default:
+      return false;
+  }
+}
+
 InlineCacheState FeedbackNexus::StateFromFeedback() const {
   Isolate* isolate = GetIsolate();
   Object* feedback = GetFeedback();
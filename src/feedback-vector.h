@@ -174,9 +174,21 @@ class FeedbackVector : public HeapObject {
   // [deopt_count]: The number of times this function has deoptimized.
   DECL_INT32_ACCESSORS(deopt_count)
 
+  // [last_deopt_site]: Bytecode offset of the most recent eager
+  // deoptimization of optimized code at a site in this function.
+  DECL_INT32_ACCESSORS(last_deopt_site)
+
+  // [same_site_deopt_count]: The number of consecutive deoptimizations at
+  // {last_deopt_site}, used to detect deopt loops.
+  DECL_INT32_ACCESSORS(same_site_deopt_count)
+
   inline void clear_invocation_count();
   inline void increment_deopt_count();
 
+  // Records a deoptimization at bytecode offset {site} and returns how many
+  // times in a row the function has deoptimized there.
+  inline int RecordDeoptSite(int site);
+
   inline Code* optimized_code() const;
   inline OptimizationMarker optimization_marker() const;
   inline bool has_optimized_code() const;
@@ -280,6 +292,8 @@ class FeedbackVector : public HeapObject {
   V(kInvocationCountOffset, kInt32Size)      \
   V(kProfilerTicksOffset, kInt32Size)        \
   V(kDeoptCountOffset, kInt32Size)           \
+  V(kLastDeoptSiteOffset, kInt32Size)        \
+  V(kSameSiteDeoptCountOffset, kInt32Size)   \
   V(kUnalignedHeaderSize, 0)
 
   DEFINE_FIELD_OFFSET_CONSTANTS(HeapObject::kHeaderSize, FEEDBACK_VECTOR_FIELDS)
@@ -605,6 +619,10 @@ class FeedbackNexus final {
   void ConfigureUninitialized();
   void ConfigurePremonomorphic();
   bool ConfigureMegamorphic(IcCheckType property_type);
+  // Moves the slot to its most generic state, so that optimized code no
+  // longer speculates on it. Returns false for slot kinds that have no such
+  // state.
+  bool Generalize();
 
   inline Object* GetFeedback() const;
   inline Object* GetFeedbackExtra() const;
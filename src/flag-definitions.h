@@ -383,6 +383,9 @@ DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
 DEFINE_BOOL(block_concurrent_recompilation, false,
             "block queued jobs until released")
+DEFINE_INT(max_same_site_deopts, 3,
+           "generalize the feedback at a bytecode after optimized code "
+           "deoptimized there this many times in a row (0 = never)")
 
 // Flags for stress-testing the compiler.
 DEFINE_INT(stress_runs, 0, "number of stress runs")
@@ -395,6 +398,9 @@ DEFINE_BOOL(turbo_sp_frame_access, false,
             "use stack pointer-relative access to frame wherever possible")
 DEFINE_BOOL(turbo_preprocess_ranges, true,
             "run pre-register allocation heuristics")
+DEFINE_INT(turbo_fast_regalloc_threshold, 50000,
+           "number of instructions above which the register allocator skips "
+           "the pre-register allocation heuristics to save compile time")
 DEFINE_STRING(turbo_filter, "*", "optimization filter for TurboFan compiler")
 DEFINE_BOOL(trace_turbo, false, "trace generated TurboFan IR")
 DEFINE_BOOL(trace_turbo_graph, false, "trace generated TurboFan graphs")
@@ -477,6 +483,8 @@ DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "Turbofan loop peeling")
 DEFINE_BOOL(turbo_loop_variable, true, "Turbofan loop variable optimization")
+DEFINE_BOOL(turbo_bounds_check_elimination, true,
+            "eliminate bounds checks implied by loop conditions in TurboFan")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
 DEFINE_BOOL(turbo_allocation_folding, true, "Turbofan allocation folding")
@@ -734,6 +742,13 @@ DEFINE_BOOL(verify_heap_skip_remembered_set, false,
 #endif
 DEFINE_BOOL(move_object_start, true, "enable moving of object starts")
 DEFINE_BOOL(memory_reducer, true, "use memory reducer")
+DEFINE_BOOL(flush_bytecode, true,
+            "flush the bytecode of functions that have not been executed for "
+            "several full GCs when reducing the memory footprint")
+DEFINE_INT(flush_bytecode_age, 3,
+           "number of full GCs without executing a function after which its "
+           "bytecode is flushed (1 to 5)")
+DEFINE_BOOL(trace_flush_bytecode, false, "trace bytecode flushing")
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
@@ -853,6 +868,9 @@ DEFINE_BOOL(trace, false, "trace function calls")
 
 // codegen.cc
 DEFINE_BOOL(lazy, true, "use lazy compilation")
+DEFINE_BOOL(lazy_feedback_allocation, true,
+            "allocate feedback vectors of closures of already compiled "
+            "functions on their first call rather than upon instantiation")
 DEFINE_BOOL(trace_opt, false, "trace lazy optimization")
 DEFINE_BOOL(trace_opt_verbose, false, "extra verbose compilation tracing")
 DEFINE_IMPLICATION(trace_opt_verbose, trace_opt)
@@ -874,6 +892,9 @@ DEFINE_BOOL(external_reference_stats, false,
 
 // compilation-cache.cc
 DEFINE_BOOL(compilation_cache, true, "enable compilation cache")
+DEFINE_INT(regexp_persistent_cache_size, 256,
+           "maximum number of regexps kept in the compilation cache "
+           "regardless of garbage collections (0 to disable)")
 
 DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 
@@ -1054,6 +1075,25 @@ DEFINE_BOOL(serialization_statistics, false,
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
 DEFINE_BOOL(regexp_mode_modifiers, false, "enable inline flags in regexp.")
+DEFINE_BOOL(regexp_tier_up, false,
+            "interpret regexps first and compile them to native code once "
+            "they are hot")
+DEFINE_INT(regexp_tier_up_ticks, 1,
+           "number of interpreted executions before a regexp is compiled to "
+           "native code")
+DEFINE_BOOL(trace_regexp_tier_up, false, "trace regexp tier-up")
+DEFINE_BOOL(enable_regexp_linear_flag, false,
+            "enable the 'l' regexp flag, which selects the linear-time engine")
+DEFINE_BOOL(regexp_linear_fallback, false,
+            "switch to the linear-time engine when a regexp backtracks too "
+            "much")
+DEFINE_INT(regexp_backtracks_before_fallback, 50000,
+           "number of backtracks in one match attempt after which the "
+           "linear-time engine takes over (only counted by the bytecode "
+           "interpreter and x64 native code; native code on other "
+           "architectures never falls back)")
+DEFINE_BOOL(trace_regexp_linear_fallback, false,
+            "trace switches to the linear-time regexp engine")
 
 // Testing flags test/cctest/test-{flags,api,serialization}.cc
 DEFINE_BOOL(testing_bool_flag, true, "testing_bool_flag")
@@ -311,6 +311,8 @@ Handle<FeedbackVector> Factory::NewFeedbackVector(
   vector->set_invocation_count(0);
   vector->set_profiler_ticks(0);
   vector->set_deopt_count(0);
+  vector->set_last_deopt_site(0);
+  vector->set_same_site_deopt_count(0);
   // TODO(leszeks): Initialize based on the feedback metadata.
   MemsetPointer(vector->slots_start(), *undefined_value(), length);
   return vector;
@@ -523,9 +525,9 @@ MaybeHandle<String> Factory::NewStringFromUtf8(Vector<const char> string,
 
   // Copy ASCII portion.
   uint16_t* data = result->GetChars();
-  for (int i = 0; i < non_ascii_start; i++) {
-    *data++ = *ascii_data++;
-  }
+  CopyChars(data, reinterpret_cast<const uint8_t*>(ascii_data),
+            non_ascii_start);
+  data += non_ascii_start;
 
   // Now write the remainder.
   decoder->WriteUtf16(data, utf16_length, non_ascii);
@@ -568,9 +570,9 @@ MaybeHandle<String> Factory::NewStringFromUtf8SubString(
 
   // Copy ASCII portion.
   uint16_t* data = result->GetChars();
-  for (int i = 0; i < non_ascii_start; i++) {
-    *data++ = *ascii_data++;
-  }
+  CopyChars(data, reinterpret_cast<const uint8_t*>(ascii_data),
+            non_ascii_start);
+  data += non_ascii_start;
 
   // Now write the remainder.
   decoder->WriteUtf16(data, utf16_length, non_ascii);
@@ -1954,6 +1956,8 @@ Handle<FeedbackVector> Factory::CopyFeedbackVector(
     result->set_invocation_count(array->invocation_count());
     result->set_profiler_ticks(array->profiler_ticks());
     result->set_deopt_count(array->deopt_count());
+    result->set_last_deopt_site(array->last_deopt_site());
+    result->set_same_site_deopt_count(array->same_site_deopt_count());
     for (int i = 0; i < len; i++) result->set(i, array->get(i), mode);
   }
   return result;
@@ -3579,6 +3583,10 @@ void Factory::SetRegExpIrregexpData(Handle<JSRegExp> regexp,
   store->set(JSRegExp::kIrregexpMaxRegisterCountIndex, Smi::kZero);
   store->set(JSRegExp::kIrregexpCaptureCountIndex, Smi::FromInt(capture_count));
   store->set(JSRegExp::kIrregexpCaptureNameMapIndex, uninitialized);
+  int ticks = FLAG_regexp_tier_up ? Max(0, FLAG_regexp_tier_up_ticks) : 0;
+  store->set(JSRegExp::kIrregexpTicksUntilTierUpIndex, Smi::FromInt(ticks));
+  store->set(JSRegExp::kIrregexpNfaProgramIndex, uninitialized);
+  store->set(JSRegExp::kIrregexpBacktrackLimitIndex, Smi::kZero);
   regexp->set_data(*store);
 }
 
@@ -21,6 +21,7 @@
 #include "src/debug/debug.h"
 #include "src/deoptimizer.h"
 #include "src/feedback-vector.h"
+#include "src/frames-inl.h"
 #include "src/global-handles.h"
 #include "src/heap/array-buffer-collector.h"
 #include "src/heap/array-buffer-tracker-inl.h"
@@ -61,6 +62,7 @@
 #include "src/utils-inl.h"
 #include "src/utils.h"
 #include "src/v8.h"
+#include "src/v8threads.h"
 #include "src/vm-state-inl.h"
 
 // Has to be the last include (doesn't have include guards):
@@ -1224,6 +1226,12 @@ void Heap::CollectAllAvailableGarbage(GarbageCollectionReason gc_reason) {
   isolate()->ClearSerializerData();
   set_current_gc_flags(kMakeHeapIterableMask | kReduceMemoryFootprintMask);
   isolate_->compilation_cache()->Clear();
+  // A last resort GC may be triggered from within an allocation, where
+  // functions cannot safely be decompiled.
+  if (FLAG_flush_bytecode &&
+      gc_reason != GarbageCollectionReason::kLastResort) {
+    FlushOldBytecode();
+  }
   const int kMaxNumberOfAttempts = 7;
   const int kMinNumberOfAttempts = 2;
   for (int attempt = 0; attempt < kMaxNumberOfAttempts; attempt++) {
@@ -1434,6 +1442,7 @@ int Heap::NotifyContextDisposed(bool dependant_context) {
     memory_reducer_->NotifyPossibleGarbage(event);
   }
   isolate()->AbortConcurrentOptimization(BlockingBehavior::kDontBlock);
+  isolate_->compilation_cache()->MarkContextDisposed();
 
   number_of_disposed_maps_ = retained_maps()->length();
   tracer()->AddContextDisposalTime(MonotonicallyIncreasingTimeInMs());
@@ -3361,6 +3370,7 @@ void Heap::CollectGarbageOnMemoryPressure() {
   const double kMaxMemoryPressurePauseMs = 100;
 
   double start = MonotonicallyIncreasingTimeInMs();
+  if (FLAG_flush_bytecode) FlushOldBytecode();
   CollectAllGarbage(kReduceMemoryFootprintMask | kAbortIncrementalMarkingMask,
                     GarbageCollectionReason::kMemoryPressure,
                     kGCCallbackFlagCollectAllAvailableGarbage);
@@ -3390,6 +3400,151 @@ void Heap::CollectGarbageOnMemoryPressure() {
   }
 }
 
+namespace {
+
+void AddInlinedFunctions(Code* code,
+                         std::unordered_set<SharedFunctionInfo*>* functions) {
+  DCHECK_EQ(Code::OPTIMIZED_FUNCTION, code->kind());
+  DeoptimizationData* const data =
+      DeoptimizationData::cast(code->deoptimization_data());
+  if (data->length() == 0) return;
+  functions->insert(SharedFunctionInfo::cast(data->SharedFunctionInfo()));
+  FixedArray* const literals = data->LiteralArray();
+  int const inlined_count = data->InlinedFunctionCount()->value();
+  for (int i = 0; i < inlined_count; ++i) {
+    functions->insert(SharedFunctionInfo::cast(literals->get(i)));
+  }
+}
+
+// Collects the functions (including inlined ones) of all JavaScript frames,
+// whose bytecode is still needed to continue or deoptimize the activation.
+class ActiveFunctionsCollector : public ThreadVisitor {
+ public:
+  explicit ActiveFunctionsCollector(
+      std::unordered_set<SharedFunctionInfo*>* functions)
+      : functions_(functions) {}
+
+  void VisitThread(Isolate* isolate, ThreadLocalTop* top) override {
+    for (JavaScriptFrameIterator it(isolate, top); !it.done(); it.Advance()) {
+      std::vector<SharedFunctionInfo*> functions;
+      it.frame()->GetFunctions(&functions);
+      functions_->insert(functions.begin(), functions.end());
+    }
+  }
+
+ private:
+  std::unordered_set<SharedFunctionInfo*>* functions_;
+};
+
+bool IsBytecodeFlushingCandidate(SharedFunctionInfo* shared) {
+  // Functions with an InterpreterData own a trampoline copy referencing the
+  // bytecode, leave them alone.
+  if (!shared->function_data()->IsBytecodeArray()) return false;
+  // Every full GC makes the bytecode one step older, executing it resets the
+  // age, and the age saturates at kLastBytecodeAge.
+  int const flush_age =
+      std::max(1, std::min(FLAG_flush_bytecode_age,
+                           static_cast<int>(BytecodeArray::kLastBytecodeAge)));
+  if (shared->GetBytecodeArray()->bytecode_age() < flush_age) return false;
+  // Top-level code cannot be lazily recompiled.
+  if (shared->is_toplevel() || shared->HasDebugInfo()) return false;
+  // Recompilation needs the source.
+  Object* script = shared->script();
+  if (!script->IsScript() || !Script::cast(script)->source()->IsString()) {
+    return false;
+  }
+  return shared->CanFlushCompiled();
+}
+
+}  // namespace
+
+void Heap::FlushOldBytecode() {
+  // The debugger and precise coverage depend on bytecode and feedback being
+  // kept around.
+  if (isolate()->debug()->is_active() ||
+      !isolate()->is_best_effort_code_coverage()) {
+    return;
+  }
+  // Pending concurrent jobs could install code that inlines a flushed
+  // function.
+  isolate()->AbortConcurrentOptimization(BlockingBehavior::kBlock);
+
+  DisallowHeapAllocation no_gc;
+  std::unordered_set<SharedFunctionInfo*> in_use;
+  ActiveFunctionsCollector collector(&in_use);
+  collector.VisitThread(isolate(), isolate()->thread_local_top());
+  isolate()->thread_manager()->IterateArchivedThreads(&collector);
+  // Deoptimizing optimized code rematerializes interpreter frames, so the
+  // bytecode of all functions inlined into live optimized code is needed.
+  Code::OptimizedCodeIterator code_iterator(isolate());
+  while (Code* code = code_iterator.Next()) {
+    AddInlinedFunctions(code, &in_use);
+  }
+
+  std::vector<SharedFunctionInfo*> candidates;
+  {
+    HeapIterator iterator(this);
+    while (HeapObject* obj = iterator.next()) {
+      if (obj->IsSharedFunctionInfo()) {
+        SharedFunctionInfo* shared = SharedFunctionInfo::cast(obj);
+        if (IsBytecodeFlushingCandidate(shared)) candidates.push_back(shared);
+      } else if (obj->IsJSGeneratorObject()) {
+        // Suspended generators resume in the interpreter.
+        in_use.insert(JSGeneratorObject::cast(obj)->function()->shared());
+      } else if (obj->IsJSFunction()) {
+        Code* code = JSFunction::cast(obj)->code();
+        if (code->kind() == Code::OPTIMIZED_FUNCTION) {
+          AddInlinedFunctions(code, &in_use);
+        }
+      }
+    }
+  }
+
+  std::unordered_set<SharedFunctionInfo*> flushed;
+  size_t flushed_bytes = 0;
+  for (SharedFunctionInfo* shared : candidates) {
+    if (in_use.count(shared)) continue;
+    flushed_bytes += shared->GetBytecodeArray()->Size();
+    shared->FlushCompiled();
+    shared->set_has_flushed_bytecode(true);
+    flushed.insert(shared);
+  }
+  if (flushed.empty()) return;
+
+  // Send all closures of flushed functions back through CompileLazy. The
+  // feedback metadata went away with the bytecode, so every feedback vector
+  // of a flushed function is dropped as well, including those in the
+  // feedback cells of closures that do not exist (anymore). They are
+  // recreated against the new metadata after recompilation.
+  Code* compile_lazy = isolate()->builtins()->builtin(Builtins::kCompileLazy);
+  {
+    HeapIterator iterator(this);
+    while (HeapObject* obj = iterator.next()) {
+      if (obj->IsJSFunction()) {
+        JSFunction* function = JSFunction::cast(obj);
+        if (flushed.count(function->shared())) function->set_code(compile_lazy);
+      } else if (obj->IsFeedbackCell()) {
+        FeedbackCell* cell = FeedbackCell::cast(obj);
+        if (cell->value()->IsFeedbackVector() &&
+            flushed.count(
+                FeedbackVector::cast(cell->value())->shared_function_info())) {
+          cell->set_value(undefined_value());
+        }
+      }
+    }
+  }
+
+  isolate()->counters()->bytecode_arrays_flushed()->Increment(
+      static_cast<int>(flushed.size()));
+  isolate()->counters()->bytecode_bytes_flushed()->Increment(
+      static_cast<int>(flushed_bytes));
+  if (FLAG_trace_flush_bytecode) {
+    PrintIsolate(isolate(),
+                 "Flushed bytecode of %" PRIuS " functions (%" PRIuS " KB)\n",
+                 flushed.size(), flushed_bytes / KB);
+  }
+}
+
 void Heap::MemoryPressureNotification(MemoryPressureLevel level,
                                       bool is_isolate_locked) {
   MemoryPressureLevel previous = memory_pressure_level_.Value();
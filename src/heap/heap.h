@@ -1201,6 +1201,14 @@ class Heap {
   // Invoked when GC was requested via the stack guard.
   void HandleGCRequest();
 
+  // Drops the bytecode of functions that have not been executed during the
+  // last --flush-bytecode-age full GCs, and resets their closures and
+  // feedback cells so that they are recompiled lazily. Must only be called
+  // at a point where arbitrary functions may be recompiled, never from
+  // inside an allocation. Only the memory reducing paths flush, because the
+  // heap walks make it too expensive to do after every full GC.
+  void FlushOldBytecode();
+
   // ===========================================================================
   // Iterators. ================================================================
   // ===========================================================================
@@ -970,6 +970,11 @@ DEFINE_METHOD(
 
     var array = TO_OBJECT(this);
     var length = TO_LENGTH(array.length);
+    // Packed arrays of Smis, doubles or strings are sorted natively (and
+    // stably) when no comparison function is given.
+    if (IS_UNDEFINED(comparefn) && %ArraySortFast(array, length)) {
+      return array;
+    }
     return InnerArraySort(array, length, comparefn);
   }
 );
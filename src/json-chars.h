@@ -0,0 +1,59 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_JSON_CHARS_H_
+#define V8_JSON_CHARS_H_
+
+#include "src/globals.h"
+#include "src/utils.h"
+
+namespace v8 {
+namespace internal {
+
+// Character scanning shared by the JSON parser and stringifier.
+class JsonChars : public AllStatic {
+ public:
+  // Returns whether {c} can appear unescaped inside a JSON string literal.
+  static bool IsPlain(uint8_t c) { return c >= 0x20 && c != '"' && c != '\\'; }
+
+  // Returns the length of the longest prefix of [start, end) that consists of
+  // plain characters only, checking a word at a time where possible.
+  static int PlainPrefixLength(const uint8_t* start, const uint8_t* end) {
+    const uint8_t* cursor = start;
+    while (cursor < end &&
+           !IsAligned(reinterpret_cast<intptr_t>(cursor), sizeof(uintptr_t))) {
+      if (!IsPlain(*cursor)) return static_cast<int>(cursor - start);
+      ++cursor;
+    }
+    while (cursor + sizeof(uintptr_t) <= end) {
+      uintptr_t w = *reinterpret_cast<const uintptr_t*>(cursor);
+      if ((AnyByteLessThan(w, 0x20) | AnyByteEqualTo(w, '"') |
+           AnyByteEqualTo(w, '\\')) != 0) {
+        break;
+      }
+      cursor += sizeof(uintptr_t);
+    }
+    while (cursor < end && IsPlain(*cursor)) ++cursor;
+    return static_cast<int>(cursor - start);
+  }
+
+ private:
+  static const uintptr_t kOneInEveryByte = kUintptrAllBitsSet / 0xFF;
+  static const uintptr_t kHighBitInEveryByte = kOneInEveryByte << 7;
+
+  // Returns a non-zero word iff some byte of {w} is less than {n}, which must
+  // be at most 0x80. The set bits don't reliably identify the byte.
+  static uintptr_t AnyByteLessThan(uintptr_t w, uint8_t n) {
+    return (w - kOneInEveryByte * n) & ~w & kHighBitInEveryByte;
+  }
+
+  static uintptr_t AnyByteEqualTo(uintptr_t w, uint8_t c) {
+    return AnyByteLessThan(w ^ (kOneInEveryByte * c), 1);
+  }
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_JSON_CHARS_H_
@@ -8,10 +8,11 @@
 #include "src/conversions.h"
 #include "src/debug/debug.h"
 #include "src/field-type.h"
+#include "src/json-chars.h"
 #include "src/messages.h"
 #include "src/objects-inl.h"
 #include "src/property-descriptor.h"
-#include "src/string-hasher.h"
+#include "src/string-hasher-inl.h"
 #include "src/transitions.h"
 #include "src/unicode-cache.h"
 
@@ -48,6 +49,28 @@ class VectorSegment {
   const typename Container::size_type begin_;
 };
 
+inline bool IsJsonWhitespace(uc32 c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+// Returns the number of JSON whitespace characters at the start of
+// [start, end). Runs of spaces, as found in indented JSON, are skipped a word
+// at a time.
+int ScanJsonWhitespace(const uint8_t* start, const uint8_t* end) {
+  const uintptr_t kAllSpaces = kUintptrAllBitsSet / 0xFF * ' ';
+  const uint8_t* cursor = start;
+  while (cursor < end && IsJsonWhitespace(*cursor)) {
+    ++cursor;
+    if (IsAligned(reinterpret_cast<intptr_t>(cursor), sizeof(uintptr_t))) {
+      while (cursor + sizeof(uintptr_t) <= end &&
+             *reinterpret_cast<const uintptr_t*>(cursor) == kAllSpaces) {
+        cursor += sizeof(uintptr_t);
+      }
+    }
+  }
+  return static_cast<int>(cursor - start);
+}
+
 }  // namespace
 
 MaybeHandle<Object> JsonParseInternalizer::Internalize(Isolate* isolate,
@@ -224,16 +247,22 @@ void JsonParser<seq_one_byte>::Advance() {
 
 template <bool seq_one_byte>
 void JsonParser<seq_one_byte>::AdvanceSkipWhitespace() {
-  do {
-    Advance();
-  } while (c0_ == ' ' || c0_ == '\t' || c0_ == '\n' || c0_ == '\r');
+  Advance();
+  SkipWhitespace();
 }
 
 template <bool seq_one_byte>
 void JsonParser<seq_one_byte>::SkipWhitespace() {
-  while (c0_ == ' ' || c0_ == '\t' || c0_ == '\n' || c0_ == '\r') {
-    Advance();
+  if (!IsJsonWhitespace(c0_)) return;
+  if (seq_one_byte) {
+    const uint8_t* chars = seq_source_->GetChars();
+    position_ += ScanJsonWhitespace(chars + position_, chars + source_length_);
+    c0_ = position_ < source_length_ ? chars[position_] : kEndOfString;
+    return;
   }
+  do {
+    Advance();
+  } while (IsJsonWhitespace(c0_));
 }
 
 template <bool seq_one_byte>
@@ -279,7 +308,8 @@ bool JsonParser<seq_one_byte>::ParseJsonString(Handle<String> expected) {
 
 // Parse any JSON value.
 template <bool seq_one_byte>
-Handle<Object> JsonParser<seq_one_byte>::ParseJsonValue() {
+Handle<Object> JsonParser<seq_one_byte>::ParseJsonValue(
+    Handle<Map> feedback) {
   StackLimitCheck stack_check(isolate_);
   if (stack_check.HasOverflowed()) {
     isolate_->StackOverflow();
@@ -293,7 +323,7 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonValue() {
 
   if (c0_ == '"') return ParseJsonString();
   if ((c0_ >= '0' && c0_ <= '9') || c0_ == '-') return ParseJsonNumber();
-  if (c0_ == '{') return ParseJsonObject();
+  if (c0_ == '{') return ParseJsonObject(feedback);
   if (c0_ == '[') return ParseJsonArray();
   if (c0_ == 'f') {
     if (AdvanceGetChar() == 'a' && AdvanceGetChar() == 'l' &&
@@ -360,7 +390,8 @@ ParseElementResult JsonParser<seq_one_byte>::ParseElement(
 
 // Parse a JSON object. Position must be right at '{'.
 template <bool seq_one_byte>
-Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
+Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject(
+    Handle<Map> feedback) {
   HandleScope scope(isolate());
   Handle<JSObject> json_object =
       factory()->NewJSObject(object_constructor(), pretenure_);
@@ -411,7 +442,24 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
           target = transitions.ExpectedTransitionTarget();
         }
       }
-      if (!follow_expected) {
+      bool key_parsed = follow_expected;
+      if (!key_parsed && seq_one_byte && !feedback.is_null() &&
+          descriptor < feedback->NumberOfOwnDescriptors()) {
+        // Compare the sibling's key at this position directly against the
+        // input, which saves hashing and internalizing the key.
+        Name* name = feedback->instance_descriptors()->GetKey(descriptor);
+        if (name->IsString()) {
+          Handle<String> expected(String::cast(name), isolate());
+          if (ParseJsonString(expected)) {
+            key = expected;
+            key_parsed = true;
+            transitioning =
+                TransitionsAccessor(map).FindTransitionToField(key).ToHandle(
+                    &target);
+          }
+        }
+      }
+      if (!key_parsed) {
         // If the expected transition failed, parse an internalized string and
         // try to find a matching transition.
         key = ParseJsonString();
@@ -575,14 +623,29 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonArray() {
   DCHECK_EQ(c0_, '[');
 
   ElementKindLattice lattice;
+  // The map of the previous object element is kept in a single handle that
+  // is updated in place, so that long arrays of objects don't allocate a new
+  // handle per element.
+  Handle<Map> feedback_map;
+  bool use_feedback = false;
 
   AdvanceSkipWhitespace();
   if (c0_ != ']') {
     do {
-      Handle<Object> element = ParseJsonValue();
+      Handle<Object> element =
+          ParseJsonValue(use_feedback ? feedback_map : Handle<Map>());
       if (element.is_null()) return ReportUnexpectedCharacter();
       elements.push_back(element);
       lattice.Update(element);
+      if (element->IsJSObject()) {
+        Map* map = JSObject::cast(*element)->map();
+        use_feedback = !map->is_dictionary_map();
+        if (use_feedback && feedback_map.is_null()) {
+          feedback_map = handle(map, isolate());
+        } else if (use_feedback) {
+          *feedback_map.location() = map;
+        }
+      }
     } while (MatchSkipWhiteSpace(','));
     if (c0_ != ']') {
       return ReportUnexpectedCharacter();
@@ -635,7 +698,7 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonNumber() {
     // a decimal point or exponent.
     if (IsDecimalDigit(c0_)) return ReportUnexpectedCharacter();
   } else {
-    int i = 0;
+    uint64_t i = 0;
     int digits = 0;
     if (c0_ < '1' || c0_ > '9') return ReportUnexpectedCharacter();
     do {
@@ -643,9 +706,21 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonNumber() {
       digits++;
       Advance();
     } while (IsDecimalDigit(c0_));
-    if (c0_ != '.' && c0_ != 'e' && c0_ != 'E' && digits < 10) {
-      SkipWhitespace();
-      return Handle<Smi>(Smi::FromInt((negative ? -i : i)), isolate());
+    if (c0_ != '.' && c0_ != 'e' && c0_ != 'E') {
+      if (digits < 10) {
+        SkipWhitespace();
+        int value = static_cast<int>(i);
+        return Handle<Smi>(Smi::FromInt(negative ? -value : value),
+                           isolate());
+      }
+      // Integers of up to 15 digits are exactly representable as doubles,
+      // which covers e.g. millisecond timestamps without a trip through
+      // StringToDouble.
+      if (digits <= 15) {
+        SkipWhitespace();
+        double value = static_cast<double>(i);
+        return factory()->NewNumber(negative ? -value : value, pretenure_);
+      }
     }
   }
   if (c0_ == '.') {
@@ -736,6 +811,18 @@ Handle<String> JsonParser<seq_one_byte>::SlowScanJsonString(
       // We need to create a longer sequential string for the result.
       return SlowScanJsonString<StringType, SinkChar>(seq_string, 0, count);
     }
+    if (seq_one_byte && c0_ != '\\') {
+      // Copy the whole run of characters that need no unescaping at once.
+      const uint8_t* chars = seq_source_->GetChars() + position_;
+      int run = JsonChars::PlainPrefixLength(
+          chars, chars + Min(source_length_ - position_, length - count));
+      DCHECK_LT(0, run);
+      CopyChars(seq_string->GetChars() + count, chars, run);
+      count += run;
+      position_ += run - 1;
+      Advance();
+      continue;
+    }
     if (c0_ != '\\') {
       // If the sink can contain UC16 characters, or source_ contains only
       // Latin1 characters, there's no need to test whether we can store the
@@ -828,57 +915,36 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
     // while we are iterating a string and manually inline StringTable lookup
     // here.
 
-    int position = position_;
-    uc32 c0 = c0_;
-    uint32_t running_hash = isolate()->heap()->HashSeed();
-    uint32_t index = 0;
-    bool is_array_index = true;
-
-    do {
-      if (c0 == '\\') {
-        c0_ = c0;
-        int beg_pos = position_;
-        position_ = position;
-        return SlowScanJsonString<SeqOneByteString, uint8_t>(source_, beg_pos,
-                                                             position_);
-      }
-      if (c0 < 0x20) {
-        c0_ = c0;
-        position_ = position;
-        return Handle<String>::null();
-      }
-      if (is_array_index) {
-        // With leading zero, the string has to be "0" to be a valid index.
-        if (!IsDecimalDigit(c0) || (position > position_ && index == 0)) {
-          is_array_index = false;
-        } else {
-          int d = c0 - '0';
-          is_array_index = index <= 429496729U - ((d + 3) >> 3);
-          index = (index * 10) + d;
-        }
-      }
-      running_hash = StringHasher::AddCharacterCore(running_hash,
-                                                    static_cast<uint16_t>(c0));
-      position++;
-      if (position >= source_length_) {
-        c0_ = kEndOfString;
-        position_ = position;
-        return Handle<String>::null();
-      }
-      c0 = seq_source_->SeqOneByteStringGet(position);
-    } while (c0 != '"');
-    int length = position - position_;
-    uint32_t hash;
-    if (is_array_index) {
-      hash =
-          StringHasher::MakeArrayIndexHash(index, length) >> String::kHashShift;
-    } else if (length <= String::kMaxHashCalcLength) {
-      hash = StringHasher::GetHashCore(running_hash);
-    } else {
-      hash = static_cast<uint32_t>(length);
+    // Find the end of the string a word at a time first, then hash it in
+    // one go.
+    const uint8_t* chars = seq_source_->GetChars();
+    int position = position_ + JsonChars::PlainPrefixLength(
+                                   chars + position_, chars + source_length_);
+    if (position >= source_length_) {
+      c0_ = kEndOfString;
+      position_ = position;
+      return Handle<String>::null();
     }
-    Vector<const uint8_t> string_vector(seq_source_->GetChars() + position_,
-                                        length);
+    uc32 c0 = chars[position];
+    if (c0 == '\\') {
+      c0_ = c0;
+      int beg_pos = position_;
+      position_ = position;
+      return SlowScanJsonString<SeqOneByteString, uint8_t>(source_, beg_pos,
+                                                           position_);
+    }
+    if (c0 < 0x20) {
+      c0_ = c0;
+      position_ = position;
+      return Handle<String>::null();
+    }
+    DCHECK_EQ('"', c0);
+    int length = position - position_;
+    uint32_t hash =
+        StringHasher::HashSequentialString(chars + position_, length,
+                                           isolate()->heap()->HashSeed()) >>
+        String::kHashShift;
+    Vector<const uint8_t> string_vector(chars + position_, length);
     StringTable* string_table = isolate()->heap()->string_table();
     uint32_t capacity = string_table->Capacity();
     uint32_t entry = StringTable::FirstProbe(hash, capacity);
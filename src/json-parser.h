@@ -102,7 +102,8 @@ class JsonParser BASE_EMBEDDED {
   // Parse a single JSON value from input (grammar production JSONValue).
   // A JSON value is either a (double-quoted) string literal, a number literal,
   // one of "true", "false", or "null", or an object or array literal.
-  Handle<Object> ParseJsonValue();
+  // {feedback} is passed on to ParseJsonObject.
+  Handle<Object> ParseJsonValue(Handle<Map> feedback = Handle<Map>());
 
   // Parse a JSON object literal (grammar production JSONObject).
   // An object literal is a squiggly-braced and comma separated sequence
@@ -110,7 +111,10 @@ class JsonParser BASE_EMBEDDED {
   // literal, the value is a JSON value, and the two are separated by a colon.
   // A JSON array doesn't allow numbers and identifiers as keys, like a
   // JavaScript array.
-  Handle<Object> ParseJsonObject();
+  // If not null, {feedback} is the map of a previously parsed sibling object,
+  // whose keys are tried first since records in an array usually share their
+  // layout.
+  Handle<Object> ParseJsonObject(Handle<Map> feedback);
 
   // Helper for ParseJsonObject. Parses the form "123": obj, which is recorded
   // as an element, not a property.
@@ -5,6 +5,7 @@
 #include "src/json-stringifier.h"
 
 #include "src/conversions.h"
+#include "src/json-chars.h"
 #include "src/lookup.h"
 #include "src/messages.h"
 #include "src/objects-inl.h"
@@ -84,6 +85,8 @@ const char* const JsonStringifier::JsonEscapeTable =
 JsonStringifier::JsonStringifier(Isolate* isolate)
     : isolate_(isolate), builder_(isolate), gap_(nullptr), indent_(0) {
   tojson_string_ = factory()->toJSON_string();
+  tojson_free_map_ = handle(Smi::kZero, isolate);
+  tojson_free_validity_cell_ = handle(Smi::kZero, isolate);
   stack_ = factory()->NewJSArray(8);
 }
 
@@ -187,6 +190,7 @@ bool JsonStringifier::InitializeGap(Handle<Object> gap) {
 
 MaybeHandle<Object> JsonStringifier::ApplyToJsonFunction(Handle<Object> object,
                                                          Handle<Object> key) {
+  if (IsKnownToHaveNoToJsonFunction(object)) return object;
   HandleScope scope(isolate_);
 
   Handle<Object> object_for_lookup = object;
@@ -202,7 +206,12 @@ MaybeHandle<Object> JsonStringifier::ApplyToJsonFunction(Handle<Object> object,
     LookupIterator it(object_for_lookup, tojson_string_,
                       LookupIterator::PROTOTYPE_CHAIN_SKIP_INTERCEPTOR);
     ASSIGN_RETURN_ON_EXCEPTION(isolate_, fun, Object::GetProperty(&it), Object);
-    if (!fun->IsCallable()) return object;
+    if (!fun->IsCallable()) {
+      if (it.state() == LookupIterator::NOT_FOUND) {
+        RememberHasNoToJsonFunction(object);
+      }
+      return object;
+    }
   }
 
   // Call toJSON function.
@@ -214,6 +223,27 @@ MaybeHandle<Object> JsonStringifier::ApplyToJsonFunction(Handle<Object> object,
   return scope.CloseAndEscape(object);
 }
 
+bool JsonStringifier::IsKnownToHaveNoToJsonFunction(Handle<Object> object) {
+  if (!object->IsJSObject()) return false;
+  if (HeapObject::cast(*object)->map() != *tojson_free_map_) return false;
+  // The validity cell is invalidated when any object on the prototype chain
+  // changes, e.g. when a toJSON function is added to Object.prototype.
+  Object* cell = *tojson_free_validity_cell_;
+  return cell->IsSmi() ||
+         Cell::cast(cell)->value() == Smi::FromInt(Map::kPrototypeChainValid);
+}
+
+void JsonStringifier::RememberHasNoToJsonFunction(Handle<Object> object) {
+  if (!object->IsJSObject()) return;
+  Handle<Map> map(HeapObject::cast(*object)->map(), isolate_);
+  // Dictionary maps are shared by objects with different properties.
+  if (map->is_dictionary_map() || map->IsSpecialReceiverMap()) return;
+  Handle<Object> cell =
+      Map::GetOrCreatePrototypeChainValidityCell(map, isolate_);
+  *tojson_free_map_.location() = *map;
+  *tojson_free_validity_cell_.location() = *cell;
+}
+
 MaybeHandle<Object> JsonStringifier::ApplyReplacerFunction(
     Handle<Object> value, Handle<Object> key, Handle<Object> initial_holder) {
   HandleScope scope(isolate_);
@@ -639,8 +669,19 @@ void JsonStringifier::SerializeStringUnchecked_(
   // The <uc16, char> version of this method must not be called.
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
 
-  for (int i = 0; i < src.length(); i++) {
-    SrcChar c = src[i];
+  const SrcChar* chars = src.start();
+  const SrcChar* end = chars + src.length();
+  while (chars < end) {
+    if (sizeof(SrcChar) == 1) {
+      // Copy runs of characters that need no escaping in bulk.
+      int run = JsonChars::PlainPrefixLength(
+          reinterpret_cast<const uint8_t*>(chars),
+          reinterpret_cast<const uint8_t*>(end));
+      dest->AppendChars(chars, run);
+      chars += run;
+      if (chars == end) break;
+    }
+    SrcChar c = *chars++;
     if (DoNotEscape(c)) {
       dest->Append(c);
     } else {
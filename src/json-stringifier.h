@@ -29,6 +29,10 @@ class JsonStringifier BASE_EMBEDDED {
 
   V8_WARN_UNUSED_RESULT MaybeHandle<Object> ApplyToJsonFunction(
       Handle<Object> object, Handle<Object> key);
+  // Objects that share a map and prototype chain with an object that was
+  // already found to have no toJSON function can skip the lookup.
+  bool IsKnownToHaveNoToJsonFunction(Handle<Object> object);
+  void RememberHasNoToJsonFunction(Handle<Object> object);
   V8_WARN_UNUSED_RESULT MaybeHandle<Object> ApplyReplacerFunction(
       Handle<Object> value, Handle<Object> key, Handle<Object> initial_holder);
 
@@ -109,6 +113,8 @@ class JsonStringifier BASE_EMBEDDED {
   Isolate* isolate_;
   IncrementalStringBuilder builder_;
   Handle<String> tojson_string_;
+  Handle<Object> tojson_free_map_;
+  Handle<Object> tojson_free_validity_cell_;
   Handle<JSArray> stack_;
   Handle<FixedArray> property_list_;
   Handle<JSReceiver> replacer_function_;
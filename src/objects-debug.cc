@@ -1311,20 +1311,37 @@ void JSRegExp::JSRegExpVerify() {
       bool is_native = RegExpImpl::UsesNativeRegExp();
 
       FixedArray* arr = FixedArray::cast(data());
+      int ticks =
+          Smi::ToInt(arr->get(JSRegExp::kIrregexpTicksUntilTierUpIndex));
+      // Native code is only used once the regexp has tiered up.
+      bool is_interpreted = !is_native || ticks > 0;
       Object* one_byte_data = arr->get(JSRegExp::kIrregexpLatin1CodeIndex);
       // Smi : Not compiled yet (-1).
       // Code/ByteArray: Compiled code.
-      CHECK(
-          (one_byte_data->IsSmi() &&
-           Smi::ToInt(one_byte_data) == JSRegExp::kUninitializedValue) ||
-          (is_native ? one_byte_data->IsCode() : one_byte_data->IsByteArray()));
+      CHECK((one_byte_data->IsSmi() &&
+             Smi::ToInt(one_byte_data) == JSRegExp::kUninitializedValue) ||
+            (is_interpreted ? one_byte_data->IsByteArray()
+                            : one_byte_data->IsCode()));
       Object* uc16_data = arr->get(JSRegExp::kIrregexpUC16CodeIndex);
       CHECK((uc16_data->IsSmi() &&
              Smi::ToInt(uc16_data) == JSRegExp::kUninitializedValue) ||
-            (is_native ? uc16_data->IsCode() : uc16_data->IsByteArray()));
+            (is_interpreted ? uc16_data->IsByteArray() : uc16_data->IsCode()));
 
       CHECK(arr->get(JSRegExp::kIrregexpCaptureCountIndex)->IsSmi());
       CHECK(arr->get(JSRegExp::kIrregexpMaxRegisterCountIndex)->IsSmi());
+      CHECK_LE(0, ticks);
+
+      // Smi : No NFA program (-1).
+      // ByteArray: The NFA program, which replaces Irregexp code entirely.
+      Object* nfa_program = arr->get(JSRegExp::kIrregexpNfaProgramIndex);
+      if (nfa_program->IsSmi()) {
+        CHECK_EQ(JSRegExp::kUninitializedValue, Smi::ToInt(nfa_program));
+      } else {
+        CHECK(nfa_program->IsByteArray());
+        CHECK(one_byte_data->IsSmi());
+        CHECK(uc16_data->IsSmi());
+      }
+      CHECK_LE(0, Smi::ToInt(arr->get(JSRegExp::kIrregexpBacktrackLimitIndex)));
       break;
     }
     default:
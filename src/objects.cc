@@ -2533,6 +2533,78 @@ std::ostream& operator<<(std::ostream& os, const MaybeObjectBrief& v) {
   return os;
 }
 
+// static
+int Smi::LexicographicCompare(Smi* x, Smi* y) {
+  int x_value = x->value();
+  int y_value = y->value();
+
+  // If the integers are equal so are the string representations.
+  if (x_value == y_value) return 0;
+
+  // If one of the integers is zero the normal integer order is the
+  // same as the lexicographic order of the string representations.
+  if (x_value == 0 || y_value == 0)
+    return x_value < y_value ? -1 : 1;
+
+  // If only one of the integers is negative the negative number is
+  // smallest because the char code of '-' is less than the char code
+  // of any digit.  Otherwise, we make both values positive.
+
+  // Use unsigned values otherwise the logic is incorrect for -MIN_INT on
+  // architectures using 32-bit Smis.
+  uint32_t x_scaled = x_value;
+  uint32_t y_scaled = y_value;
+  if (x_value < 0 || y_value < 0) {
+    if (y_value >= 0) return -1;
+    if (x_value >= 0) return 1;
+    x_scaled = -x_value;
+    y_scaled = -y_value;
+  }
+
+  static const uint32_t kPowersOf10[] = {
+      1,                 10,                100,         1000,
+      10 * 1000,         100 * 1000,        1000 * 1000, 10 * 1000 * 1000,
+      100 * 1000 * 1000, 1000 * 1000 * 1000};
+
+  // If the integers have the same number of decimal digits they can be
+  // compared directly as the numeric order is the same as the
+  // lexicographic order.  If one integer has fewer digits, it is scaled
+  // by some power of 10 to have the same number of digits as the longer
+  // integer.  If the scaled integers are equal it means the shorter
+  // integer comes first in the lexicographic order.
+
+  // From http://graphics.stanford.edu/~seander/bithacks.html#IntegerLog10
+  int x_log2 = 31 - base::bits::CountLeadingZeros(x_scaled);
+  int x_log10 = ((x_log2 + 1) * 1233) >> 12;
+  x_log10 -= x_scaled < kPowersOf10[x_log10];
+
+  int y_log2 = 31 - base::bits::CountLeadingZeros(y_scaled);
+  int y_log10 = ((y_log2 + 1) * 1233) >> 12;
+  y_log10 -= y_scaled < kPowersOf10[y_log10];
+
+  int tie = 0;
+
+  if (x_log10 < y_log10) {
+    // X has fewer digits.  We would like to simply scale up X but that
+    // might overflow, e.g when comparing 9 with 1_000_000_000, 9 would
+    // be scaled up to 9_000_000_000. So we scale up by the next
+    // smallest power and scale down Y to drop one digit. It is OK to
+    // drop one digit from the longer integer since the final digit is
+    // past the length of the shorter integer.
+    x_scaled *= kPowersOf10[y_log10 - x_log10 - 1];
+    y_scaled /= 10;
+    tie = -1;
+  } else if (y_log10 < x_log10) {
+    y_scaled *= kPowersOf10[x_log10 - y_log10 - 1];
+    x_scaled /= 10;
+    tie = 1;
+  }
+
+  if (x_scaled < y_scaled) return -1;
+  if (x_scaled > y_scaled) return 1;
+  return tie;
+}
+
 void Smi::SmiPrint(std::ostream& os) const {  // NOLINT
   os << value();
 }
@@ -11127,6 +11199,36 @@ uint16_t SlicedString::SlicedStringGet(int index) {
   return parent()->Get(offset() + index);
 }
 
+namespace {
+
+// Copies the characters [from, to) of |source| to |sink| if |source| is a
+// sequential or external string. Returns false, without copying anything, for
+// the other representations.
+template <typename sinkchar>
+bool CopyFlatLeaf(String* source, sinkchar* sink, int from, int to) {
+  switch (StringShape(source).full_representation_tag()) {
+    case kOneByteStringTag | kSeqStringTag:
+      CopyChars(sink, SeqOneByteString::cast(source)->GetChars() + from,
+                to - from);
+      return true;
+    case kTwoByteStringTag | kSeqStringTag:
+      CopyChars(sink, SeqTwoByteString::cast(source)->GetChars() + from,
+                to - from);
+      return true;
+    case kOneByteStringTag | kExternalStringTag:
+      CopyChars(sink, ExternalOneByteString::cast(source)->GetChars() + from,
+                to - from);
+      return true;
+    case kTwoByteStringTag | kExternalStringTag:
+      CopyChars(sink, ExternalTwoByteString::cast(source)->GetChars() + from,
+                to - from);
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
 
 template <typename sinkchar>
 void String::WriteToFlat(String* src,
@@ -11170,9 +11272,12 @@ void String::WriteToFlat(String* src,
         String* first = cons_string->first();
         int boundary = first->length();
         if (to - boundary >= boundary - from) {
-          // Right hand side is longer.  Recurse over left.
+          // Right hand side is longer.  Recurse over left, unless it is a
+          // flat string, as is the case when repeatedly prepending.
           if (from < boundary) {
-            WriteToFlat(first, sink, from, boundary);
+            if (!CopyFlatLeaf(first, sink, from, boundary)) {
+              WriteToFlat(first, sink, from, boundary);
+            }
             if (from == 0 && cons_string->second() == first) {
               CopyChars(sink + boundary, sink, boundary);
               return;
@@ -11190,14 +11295,13 @@ void String::WriteToFlat(String* src,
             String* second = cons_string->second();
             // When repeatedly appending to a string, we get a cons string that
             // is unbalanced to the left, a list, essentially.  We inline the
-            // common case of sequential one-byte right child.
+            // common case of a sequential or external right child, so that
+            // such a list is copied back to front in this loop without any
+            // recursive calls.
             if (to - boundary == 1) {
               sink[boundary - from] = static_cast<sinkchar>(second->Get(0));
-            } else if (second->IsSeqOneByteString()) {
-              CopyChars(sink + boundary - from,
-                        SeqOneByteString::cast(second)->GetChars(),
-                        to - boundary);
-            } else {
+            } else if (!CopyFlatLeaf(second, sink + boundary - from, 0,
+                                     to - boundary)) {
               WriteToFlat(second,
                           sink + boundary - from,
                           0,
@@ -12116,8 +12220,7 @@ uint32_t StringHasher::GetHashField() {
     if (is_array_index_) {
       return MakeArrayIndexHash(array_index_, length_);
     }
-    return (GetHashCore(raw_running_hash_) << String::kHashShift) |
-           String::kIsNotArrayIndexMask;
+    return (GetHash() << String::kHashShift) | String::kIsNotArrayIndexMask;
   } else {
     return (length_ << String::kHashShift) | String::kIsNotArrayIndexMask;
   }
@@ -16211,6 +16314,10 @@ JSRegExp::Flags RegExpFlagsFromString(Handle<String> flags, bool* success) {
       case 'y':
         flag = JSRegExp::kSticky;
         break;
+      case 'l':
+        if (!FLAG_enable_regexp_linear_flag) return JSRegExp::Flags(0);
+        flag = JSRegExp::kLinear;
+        break;
       default:
         return JSRegExp::Flags(0);
     }
@@ -16989,10 +17096,6 @@ Handle<PropertyCell> JSGlobalObject::EnsureEmptyPropertyCell(
 
 
 // This class is used for looking up two character strings in the string table.
-// If we don't have a hit we don't want to waste much time so we unroll the
-// string hash calculation loop here for speed.  Doesn't work if the two
-// characters form a decimal integer, since such strings have a different hash
-// algorithm.
 class TwoCharHashTableKey : public StringTableKey {
  public:
   TwoCharHashTableKey(uint16_t c1, uint16_t c2, uint32_t seed)
@@ -17012,32 +17115,9 @@ class TwoCharHashTableKey : public StringTableKey {
   }
 
  private:
-  uint32_t ComputeHashField(uint16_t c1, uint16_t c2, uint32_t seed) {
-    // Char 1.
-    uint32_t hash = seed;
-    hash += c1;
-    hash += hash << 10;
-    hash ^= hash >> 6;
-    // Char 2.
-    hash += c2;
-    hash += hash << 10;
-    hash ^= hash >> 6;
-    // GetHash.
-    hash += hash << 3;
-    hash ^= hash >> 11;
-    hash += hash << 15;
-    if ((hash & String::kHashBitMask) == 0) hash = StringHasher::kZeroHash;
-    hash = (hash << String::kHashShift) | String::kIsNotArrayIndexMask;
-#ifdef DEBUG
-    // If this assert fails then we failed to reproduce the two-character
-    // version of the string hashing algorithm above.  One reason could be
-    // that we were passed two digits as characters, since the hash
-    // algorithm is different in that case.
+  static uint32_t ComputeHashField(uint16_t c1, uint16_t c2, uint32_t seed) {
     uint16_t chars[2] = {c1, c2};
-    uint32_t check_hash = StringHasher::HashSequentialString(chars, 2, seed);
-    DCHECK_EQ(hash, check_hash);
-#endif
-    return hash;
+    return StringHasher::HashSequentialString(chars, 2, seed);
   }
 
   uint16_t c1_;
@@ -17059,8 +17139,16 @@ MaybeHandle<String> StringTable::LookupTwoCharsStringIfExists(
   return result;
 }
 
-void StringTable::EnsureCapacityForDeserialization(Isolate* isolate,
-                                                   int expected) {
+MaybeHandle<String> StringTable::LookupKeyIfExists(Isolate* isolate,
+                                                   StringTableKey* key) {
+  Handle<StringTable> string_table = isolate->factory()->string_table();
+  int entry = string_table->FindEntry(key);
+  if (entry == kNotFound) return MaybeHandle<String>();
+  return handle(String::cast(string_table->KeyAt(entry)), isolate);
+}
+
+void StringTable::EnsureCapacityForBulkInsertion(Isolate* isolate,
+                                                 int expected) {
   Handle<StringTable> table = isolate->factory()->string_table();
   // We need a key instance for the virtual hash function.
   table = StringTable::EnsureCapacity(table, expected);
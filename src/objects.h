@@ -1630,6 +1630,10 @@ class Smi: public Object {
 
   DECL_CAST(Smi)
 
+  // Compares {x} and {y} as if they were converted to strings and then
+  // compared lexicographically. Returns -1, 0 or 1.
+  static int LexicographicCompare(Smi* x, Smi* y);
+
   // Dispatched behavior.
   V8_EXPORT_PRIVATE void SmiPrint(std::ostream& os) const;  // NOLINT
   DECL_VERIFIER(Smi)
@@ -44,11 +44,14 @@ class JSRegExp : public JSObject {
     kSticky = 1 << 3,
     kUnicode = 1 << 4,
     kDotAll = 1 << 5,
+    // Non-standard: match with the linear-time engine. Only accepted with
+    // --enable-regexp-linear-flag.
+    kLinear = 1 << 6,
     // Update FlagCount when adding new flags.
   };
   typedef base::Flags<Flag> Flags;
 
-  static constexpr int FlagCount() { return 6; }
+  static constexpr int FlagCount() { return 7; }
 
   DECL_ACCESSORS(data, Object)
   DECL_ACCESSORS(flags, Object)
@@ -123,8 +126,18 @@ class JSRegExp : public JSObject {
   // Maps names of named capture groups (at indices 2i) to their corresponding
   // (1-based) capture group indices (at indices 2i + 1).
   static const int kIrregexpCaptureNameMapIndex = kDataIndex + 4;
-
-  static const int kIrregexpDataSize = kIrregexpCaptureNameMapIndex + 1;
+  // Number of executions of interpreted bytecode left before the regexp is
+  // recompiled to native code. Zero once native code is used.
+  static const int kIrregexpTicksUntilTierUpIndex = kDataIndex + 5;
+  // Program for the linear-time NFA engine, used for both Latin1 and UC16
+  // subjects. Holds kUninitializedValue until the regexp either uses the
+  // linear flag or has exceeded its backtrack limit.
+  static const int kIrregexpNfaProgramIndex = kDataIndex + 6;
+  // Number of backtracks after which Irregexp gives up in favor of the NFA
+  // engine. Zero if there is no limit.
+  static const int kIrregexpBacktrackLimitIndex = kDataIndex + 7;
+
+  static const int kIrregexpDataSize = kIrregexpBacktrackLimitIndex + 1;
 
   // In-object fields.
   static const int kLastIndexFieldIndex = 0;
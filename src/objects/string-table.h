@@ -74,8 +74,14 @@ class StringTable : public HashTable<StringTable, StringTableShape> {
   V8_WARN_UNUSED_RESULT static MaybeHandle<String> LookupTwoCharsStringIfExists(
       Isolate* isolate, uint16_t c1, uint16_t c2);
   static Object* LookupStringIfExists_NoAllocate(String* string);
-
-  static void EnsureCapacityForDeserialization(Isolate* isolate, int expected);
+  // Returns the string matching |key| if the table contains one, or an empty
+  // handle otherwise.
+  V8_WARN_UNUSED_RESULT static MaybeHandle<String> LookupKeyIfExists(
+      Isolate* isolate, StringTableKey* key);
+
+  // Grows the table so that |expected| strings can be added with
+  // AddKeyNoResize.
+  static void EnsureCapacityForBulkInsertion(Isolate* isolate, int expected);
 
   DECL_CAST(StringTable)
 
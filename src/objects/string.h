@@ -375,36 +375,11 @@ class String : public Name {
   // If the return value is >= the passed length, the entire string was
   // one-byte.
   static inline int NonAsciiStart(const char* chars, int length) {
-    const char* start = chars;
-    const char* limit = chars + length;
-
-    if (length >= kIntptrSize) {
-      // Check unaligned bytes.
-      while (!IsAligned(reinterpret_cast<intptr_t>(chars), sizeof(uintptr_t))) {
-        if (static_cast<uint8_t>(*chars) > unibrow::Utf8::kMaxOneByteChar) {
-          return static_cast<int>(chars - start);
-        }
-        ++chars;
-      }
-      // Check aligned words.
-      DCHECK_EQ(unibrow::Utf8::kMaxOneByteChar, 0x7F);
-      const uintptr_t non_one_byte_mask = kUintptrAllBitsSet / 0xFF * 0x80;
-      while (chars + sizeof(uintptr_t) <= limit) {
-        if (*reinterpret_cast<const uintptr_t*>(chars) & non_one_byte_mask) {
-          return static_cast<int>(chars - start);
-        }
-        chars += sizeof(uintptr_t);
-      }
-    }
-    // Check remaining unaligned bytes.
-    while (chars < limit) {
-      if (static_cast<uint8_t>(*chars) > unibrow::Utf8::kMaxOneByteChar) {
-        return static_cast<int>(chars - start);
-      }
-      ++chars;
-    }
-
-    return static_cast<int>(chars - start);
+    DCHECK_LE(0, length);
+    DCHECK_EQ(unibrow::Utf8::kMaxOneByteChar, 0x7F);
+    return static_cast<int>(
+        AsciiPrefixLength(reinterpret_cast<const uint8_t*>(chars),
+                          static_cast<size_t>(length)));
   }
 
   static inline bool IsAscii(const char* chars, int length) {
@@ -416,9 +391,31 @@ class String : public Name {
            length;
   }
 
+  // Like NonAsciiStart, the return value may point to the first aligned word
+  // containing the first non-one-byte character.
   static inline int NonOneByteStart(const uc16* chars, int length) {
-    const uc16* limit = chars + length;
     const uc16* start = chars;
+    const uc16* limit = chars + length;
+
+    if (length >= kIntptrSize) {
+      // Check unaligned characters.
+      while (chars < limit &&
+             !IsAligned(reinterpret_cast<intptr_t>(chars), sizeof(uintptr_t))) {
+        if (*chars > kMaxOneByteCharCodeU) {
+          return static_cast<int>(chars - start);
+        }
+        ++chars;
+      }
+      // Check aligned words.
+      const uintptr_t non_one_byte_mask = kUintptrAllBitsSet / 0xFFFF * 0xFF00;
+      while (chars + sizeof(uintptr_t) / sizeof(uc16) <= limit) {
+        if (*reinterpret_cast<const uintptr_t*>(chars) & non_one_byte_mask) {
+          return static_cast<int>(chars - start);
+        }
+        chars += sizeof(uintptr_t) / sizeof(uc16);
+      }
+    }
+    // Check remaining characters.
     while (chars < limit) {
       if (*chars > kMaxOneByteCharCodeU) return static_cast<int>(chars - start);
       ++chars;
@@ -274,6 +274,17 @@ bool Utf8ExternalStreamingStream::SkipToPosition(size_t position) {
   size_t it = current_.pos.bytes - chunk.start.bytes;
   size_t chars = chunk.start.chars;
   while (it < chunk.length && chars < position) {
+    if (state == unibrow::Utf8::State::kAccept &&
+        chunk.data[it] <= unibrow::Utf8::kMaxOneByteChar) {
+      size_t ascii_length =
+          AsciiPrefixLength(chunk.data + it, std::min(chunk.length - it,
+                                                      position - chars));
+      if (ascii_length > 0) {
+        it += ascii_length;
+        chars += ascii_length;
+        continue;
+      }
+    }
     unibrow::uchar t = unibrow::Utf8::ValueOfIncremental(
         chunk.data[it], &it, &state, &incomplete_char);
     if (t == kUtf8Bom && current_.pos.chars == 0) {
@@ -325,6 +336,21 @@ void Utf8ExternalStreamingStream::FillBufferFromCurrentChunk() {
 
   size_t it = current_.pos.bytes - chunk.start.bytes;
   while (it < chunk.length && cursor + 1 < buffer_start_ + kBufferSize) {
+    // Copy ASCII runs in bulk when not in the middle of a sequence.
+    if (state == unibrow::Utf8::State::kAccept &&
+        chunk.data[it] <= unibrow::Utf8::kMaxOneByteChar) {
+      size_t ascii_length = AsciiPrefixLength(
+          chunk.data + it,
+          std::min(chunk.length - it,
+                   static_cast<size_t>(buffer_start_ + kBufferSize - 1 -
+                                       cursor)));
+      if (ascii_length > 0) {
+        CopyChars(cursor, chunk.data + it, ascii_length);
+        it += ascii_length;
+        cursor += ascii_length;
+        continue;
+      }
+    }
     unibrow::uchar t = unibrow::Utf8::ValueOfIncremental(
         chunk.data[it], &it, &state, &incomplete_char);
     if (V8_LIKELY(t < kUtf8Bom)) {
@@ -4,8 +4,6 @@
 
 // A simple interpreter for the Irregexp byte code.
 
-#ifdef V8_INTERPRETED_REGEXP
-
 #include "src/regexp/interpreter-irregexp.h"
 
 #include "src/ast/ast.h"
@@ -126,12 +124,14 @@ static int32_t Load16Aligned(const byte* pc) {
 
 
 // A simple abstraction over the backtracking stack used by the interpreter.
-// This backtracking stack does not grow automatically, but it ensures that the
-// the memory held by the stack is released or remembered in a cache if the
-// matching terminates.
+// The stack grows on demand up to the size limit of the native regexp stack,
+// so that a pattern does not fail with a stack overflow only because it is
+// still interpreted. It ensures that the memory held by the stack is
+// released if the matching terminates.
 class BacktrackStack {
  public:
-  BacktrackStack() { data_ = NewArray<int>(kBacktrackStackSize); }
+  BacktrackStack()
+      : data_(NewArray<int>(kInitialSize)), max_size_(kInitialSize) {}
 
   ~BacktrackStack() {
     DeleteArray(data_);
@@ -139,12 +139,33 @@ class BacktrackStack {
 
   int* data() const { return data_; }
 
-  int max_size() const { return kBacktrackStackSize; }
+  int max_size() const { return max_size_; }
+
+  // Makes room for at least one more element and updates the interpreter's
+  // view of the stack. Returns false if the stack has reached its limit.
+  bool Grow(int** base, int** sp, int* space) {
+    if (max_size_ >= kMaximumSize) return false;
+    int used = static_cast<int>(*sp - *base);
+    int new_size = Min(2 * max_size_, kMaximumSize);
+    int* new_data = NewArray<int>(new_size);
+    MemCopy(new_data, data_, used * sizeof(*data_));
+    DeleteArray(data_);
+    data_ = new_data;
+    max_size_ = new_size;
+    *base = data_;
+    *sp = data_ + used;
+    // Account for the element about to be pushed.
+    *space = max_size_ - used - 1;
+    return true;
+  }
 
  private:
-  static const int kBacktrackStackSize = 10000;
+  static const int kInitialSize = 10000;
+  // Same as the maximal size of the native RegExpStack.
+  static const int kMaximumSize = 64 * MB / kIntSize;
 
   int* data_;
+  int max_size_;
 
   DISALLOW_COPY_AND_ASSIGN(BacktrackStack);
 };
@@ -156,7 +177,8 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
                                            Vector<const Char> subject,
                                            int* registers,
                                            int current,
-                                           uint32_t current_char) {
+                                           uint32_t current_char,
+                                           int backtrack_limit) {
   const byte* pc = code_base;
   // BacktrackStack ensures that the memory allocated for the backtracking stack
   // is returned to the system or cached if there is no stack being cached at
@@ -165,6 +187,11 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
   int* backtrack_stack_base = backtrack_stack.data();
   int* backtrack_sp = backtrack_stack_base;
   int backtrack_stack_space = backtrack_stack.max_size();
+  int backtrack_count = 0;
+  // Like native code, we check for interrupts on every backtrack and loop
+  // back edge. They cannot be handled here, where we hold raw pointers into
+  // the heap, so the caller handles them and restarts the match.
+  StackLimitCheck check(isolate);
 #ifdef DEBUG
   if (FLAG_trace_regexp_bytecodes) {
     PrintF("\n\nStart bytecode interpreter\n\n");
@@ -176,21 +203,27 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
       BYTECODE(BREAK)
         UNREACHABLE();
       BYTECODE(PUSH_CP)
-        if (--backtrack_stack_space < 0) {
+        if (--backtrack_stack_space < 0 &&
+            !backtrack_stack.Grow(&backtrack_stack_base, &backtrack_sp,
+                                  &backtrack_stack_space)) {
           return RegExpImpl::RE_EXCEPTION;
         }
         *backtrack_sp++ = current;
         pc += BC_PUSH_CP_LENGTH;
         break;
       BYTECODE(PUSH_BT)
-        if (--backtrack_stack_space < 0) {
+        if (--backtrack_stack_space < 0 &&
+            !backtrack_stack.Grow(&backtrack_stack_base, &backtrack_sp,
+                                  &backtrack_stack_space)) {
           return RegExpImpl::RE_EXCEPTION;
         }
         *backtrack_sp++ = Load32Aligned(pc + 4);
         pc += BC_PUSH_BT_LENGTH;
         break;
       BYTECODE(PUSH_REGISTER)
-        if (--backtrack_stack_space < 0) {
+        if (--backtrack_stack_space < 0 &&
+            !backtrack_stack.Grow(&backtrack_stack_base, &backtrack_sp,
+                                  &backtrack_stack_space)) {
           return RegExpImpl::RE_EXCEPTION;
         }
         *backtrack_sp++ = registers[insn >> BYTECODE_SHIFT];
@@ -230,6 +263,10 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         pc += BC_POP_CP_LENGTH;
         break;
       BYTECODE(POP_BT)
+        if (backtrack_limit != 0 && ++backtrack_count == backtrack_limit) {
+          return RegExpImpl::RE_FALLBACK_TO_NFA;
+        }
+        if (check.InterruptRequested()) return RegExpImpl::RE_RETRY;
         backtrack_stack_space++;
         --backtrack_sp;
         pc = code_base + *backtrack_sp;
@@ -248,13 +285,23 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         current += insn >> BYTECODE_SHIFT;
         pc += BC_ADVANCE_CP_LENGTH;
         break;
-      BYTECODE(GOTO)
-        pc = code_base + Load32Aligned(pc + 4);
+      BYTECODE(GOTO) {
+        const byte* target = code_base + Load32Aligned(pc + 4);
+        if (target <= pc && check.InterruptRequested()) {
+          return RegExpImpl::RE_RETRY;
+        }
+        pc = target;
         break;
-      BYTECODE(ADVANCE_CP_AND_GOTO)
+      }
+      BYTECODE(ADVANCE_CP_AND_GOTO) {
+        const byte* target = code_base + Load32Aligned(pc + 4);
+        if (target <= pc && check.InterruptRequested()) {
+          return RegExpImpl::RE_RETRY;
+        }
         current += insn >> BYTECODE_SHIFT;
-        pc = code_base + Load32Aligned(pc + 4);
+        pc = target;
         break;
+      }
       BYTECODE(CHECK_GREEDY)
         if (current == backtrack_sp[-1]) {
           backtrack_sp--;
@@ -592,7 +639,8 @@ RegExpImpl::IrregexpResult IrregexpInterpreter::Match(
     Handle<ByteArray> code_array,
     Handle<String> subject,
     int* registers,
-    int start_position) {
+    int start_position,
+    int backtrack_limit) {
   DCHECK(subject->IsFlat());
 
   DisallowHeapAllocation no_gc;
@@ -607,7 +655,8 @@ RegExpImpl::IrregexpResult IrregexpInterpreter::Match(
                     subject_vector,
                     registers,
                     start_position,
-                    previous_char);
+                    previous_char,
+                    backtrack_limit);
   } else {
     DCHECK(subject_content.IsTwoByte());
     Vector<const uc16> subject_vector = subject_content.ToUC16Vector();
@@ -617,11 +666,10 @@ RegExpImpl::IrregexpResult IrregexpInterpreter::Match(
                     subject_vector,
                     registers,
                     start_position,
-                    previous_char);
+                    previous_char,
+                    backtrack_limit);
   }
 }
 
 }  // namespace internal
 }  // namespace v8
-
-#endif  // V8_INTERPRETED_REGEXP
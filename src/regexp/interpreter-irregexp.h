@@ -7,8 +7,6 @@
 #ifndef V8_REGEXP_INTERPRETER_IRREGEXP_H_
 #define V8_REGEXP_INTERPRETER_IRREGEXP_H_
 
-#ifdef V8_INTERPRETED_REGEXP
-
 #include "src/regexp/jsregexp.h"
 
 namespace v8 {
@@ -16,17 +14,19 @@ namespace internal {
 
 class IrregexpInterpreter {
  public:
+  // Returns RE_FALLBACK_TO_NFA once |backtrack_limit| backtracks have been
+  // performed, unless the limit is zero. Returns RE_RETRY if an interrupt is
+  // pending; the match must be restarted once it has been handled.
   static RegExpImpl::IrregexpResult Match(Isolate* isolate,
                                           Handle<ByteArray> code,
                                           Handle<String> subject,
                                           int* captures,
-                                          int start_position);
+                                          int start_position,
+                                          int backtrack_limit);
 };
 
 
 }  // namespace internal
 }  // namespace v8
 
-#endif  // V8_INTERPRETED_REGEXP
-
 #endif  // V8_REGEXP_INTERPRETER_IRREGEXP_H_
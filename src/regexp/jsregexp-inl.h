@@ -27,8 +27,9 @@ int32_t* RegExpImpl::GlobalCache::FetchNext() {
   current_match_index_++;
   if (current_match_index_ >= num_matches_) {
     // Current batch of results exhausted.
-    // Fail if last batch was not even fully filled.
-    if (num_matches_ < max_matches_) {
+    // Fail if last batch was not even fully filled. After falling back to
+    // the linear-time engine, batches hold a single match.
+    if (num_matches_ < max_matches_ && !RegExpImpl::UsesNfa(regexp_)) {
       num_matches_ = 0;  // Signal failed match.
       return nullptr;
     }
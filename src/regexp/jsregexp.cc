@@ -20,6 +20,7 @@
 #include "src/regexp/regexp-macro-assembler-irregexp.h"
 #include "src/regexp/regexp-macro-assembler-tracer.h"
 #include "src/regexp/regexp-macro-assembler.h"
+#include "src/regexp/regexp-nfa.h"
 #include "src/regexp/regexp-parser.h"
 #include "src/regexp/regexp-stack.h"
 #include "src/runtime/runtime.h"
@@ -175,7 +176,24 @@ MaybeHandle<Object> RegExpImpl::Compile(Handle<JSRegExp> re,
     }
   }
   if (!has_been_compiled) {
+    // Patterns that the linear-time engine can match are either matched by
+    // it right away or, if enabled, once Irregexp backtracks too much.
+    bool nfa_can_be_used =
+        (IsLinear(flags) || FLAG_regexp_linear_fallback) &&
+        RegExpNfa::CanBeHandled(isolate, &zone, parse_result.tree, flags,
+                                parse_result.capture_count);
+    if (IsLinear(flags) && !nfa_can_be_used) {
+      return ThrowRegExpException(
+          re, pattern,
+          isolate->factory()->NewStringFromAsciiChecked(
+              "Cannot be matched in linear time"));
+    }
     IrregexpInitialize(re, pattern, flags, parse_result.capture_count);
+    if (nfa_can_be_used && !IsLinear(flags)) {
+      SetIrregexpBacktrackLimit(
+          FixedArray::cast(re->data()),
+          Max(1, FLAG_regexp_backtracks_before_fallback));
+    }
   }
   DCHECK(re->data()->IsFixedArray());
   // Compilation succeeded so the data is set on the regexp
@@ -310,11 +328,7 @@ bool RegExpImpl::EnsureCompiledIrregexp(Handle<JSRegExp> re,
                                         Handle<String> sample_subject,
                                         bool is_one_byte) {
   Object* compiled_code = re->DataAt(JSRegExp::code_index(is_one_byte));
-#ifdef V8_INTERPRETED_REGEXP
-  if (compiled_code->IsByteArray()) return true;
-#else  // V8_INTERPRETED_REGEXP (RegExp native code)
-  if (compiled_code->IsCode()) return true;
-#endif
+  if (compiled_code->IsByteArray() || compiled_code->IsCode()) return true;
   return CompileIrregexp(re, sample_subject, is_one_byte);
 }
 
@@ -348,9 +362,15 @@ bool RegExpImpl::CompileIrregexp(Handle<JSRegExp> re,
     USE(ThrowRegExpException(re, pattern, compile_data.error));
     return false;
   }
-  RegExpEngine::CompilationResult result =
-      RegExpEngine::Compile(isolate, &zone, &compile_data, flags, pattern,
-                            sample_subject, is_one_byte);
+  // Without native regexp support everything is interpreted. Otherwise
+  // bytecode is produced until the regexp has been executed often enough to
+  // tier up.
+  Handle<FixedArray> data = Handle<FixedArray>(FixedArray::cast(re->data()));
+  bool use_bytecode =
+      !UsesNativeRegExp() || IrregexpTicksUntilTierUp(*data) > 0;
+  RegExpEngine::CompilationResult result = RegExpEngine::Compile(
+      isolate, &zone, &compile_data, flags, pattern, sample_subject,
+      is_one_byte, use_bytecode, IrregexpBacktrackLimit(*data));
   if (result.error_message != nullptr) {
     // Unable to compile regexp.
     if (FLAG_abort_on_stack_or_string_length_overflow &&
@@ -363,7 +383,6 @@ bool RegExpImpl::CompileIrregexp(Handle<JSRegExp> re,
     return false;
   }
 
-  Handle<FixedArray> data = Handle<FixedArray>(FixedArray::cast(re->data()));
   data->set(JSRegExp::code_index(is_one_byte), result.code);
   SetIrregexpCaptureNameMap(*data, compile_data.capture_name_map);
   int register_max = IrregexpMaxRegisterCount(*data);
@@ -413,6 +432,55 @@ Code* RegExpImpl::IrregexpNativeCode(FixedArray* re, bool is_one_byte) {
   return Code::cast(re->get(JSRegExp::code_index(is_one_byte)));
 }
 
+int RegExpImpl::IrregexpTicksUntilTierUp(FixedArray* re) {
+  return Smi::ToInt(re->get(JSRegExp::kIrregexpTicksUntilTierUpIndex));
+}
+
+void RegExpImpl::SetIrregexpTicksUntilTierUp(FixedArray* re, int value) {
+  re->set(JSRegExp::kIrregexpTicksUntilTierUpIndex, Smi::FromInt(value));
+}
+
+int RegExpImpl::IrregexpBacktrackLimit(FixedArray* re) {
+  return Smi::ToInt(re->get(JSRegExp::kIrregexpBacktrackLimitIndex));
+}
+
+void RegExpImpl::SetIrregexpBacktrackLimit(FixedArray* re, int value) {
+  re->set(JSRegExp::kIrregexpBacktrackLimitIndex, Smi::FromInt(value));
+}
+
+bool RegExpImpl::UsesNfa(Handle<JSRegExp> re) {
+  return re->TypeTag() == JSRegExp::IRREGEXP &&
+         re->DataAt(JSRegExp::kIrregexpNfaProgramIndex)->IsByteArray();
+}
+
+bool RegExpImpl::IrregexpIsInterpreted(FixedArray* re, bool is_one_byte) {
+  Object* code = re->get(JSRegExp::code_index(is_one_byte));
+  DCHECK(code->IsByteArray() || code->IsCode());
+  return code->IsByteArray();
+}
+
+void RegExpImpl::TickIrregexpTierUp(Handle<JSRegExp> re, bool is_one_byte) {
+  if (!UsesNativeRegExp()) return;
+  FixedArray* data = FixedArray::cast(re->data());
+  // Only executions of existing bytecode count; the first execution after
+  // creation compiles the bytecode.
+  if (!data->get(JSRegExp::code_index(is_one_byte))->IsByteArray()) return;
+  int ticks = IrregexpTicksUntilTierUp(data) - 1;
+  SetIrregexpTicksUntilTierUp(data, ticks);
+  if (ticks > 0) return;
+
+  if (FLAG_trace_regexp_tier_up) {
+    PrintF("[regexp tier-up: /%s/]\n", re->Pattern()->ToCString().get());
+  }
+  // Drop the bytecode for both encodings so that each is recompiled to
+  // native code on its next use. Once tiered up, a regexp never mixes
+  // bytecode and native code.
+  Smi* uninitialized = Smi::FromInt(JSRegExp::kUninitializedValue);
+  data->set(JSRegExp::kIrregexpLatin1CodeIndex, uninitialized);
+  data->set(JSRegExp::kIrregexpUC16CodeIndex, uninitialized);
+  re->GetIsolate()->counters()->regexp_tier_ups()->Increment();
+}
+
 
 void RegExpImpl::IrregexpInitialize(Handle<JSRegExp> re,
                                     Handle<String> pattern,
@@ -431,22 +499,32 @@ int RegExpImpl::IrregexpPrepare(Handle<JSRegExp> regexp,
                                 Handle<String> subject) {
   DCHECK(subject->IsFlat());
 
+  // The linear-time engine handles both subject encodings and, like native
+  // code, only needs room to output captures.
+  if (IsLinear(regexp->GetFlags()) && !UsesNfa(regexp)) {
+    if (!RegExpNfa::Compile(regexp)) return -1;
+  }
+  if (UsesNfa(regexp)) {
+    return (IrregexpNumberOfCaptures(FixedArray::cast(regexp->data())) + 1) *
+           2;
+  }
+
   // Check representation of the underlying storage.
   bool is_one_byte = subject->IsOneByteRepresentationUnderneath();
   if (!EnsureCompiledIrregexp(regexp, subject, is_one_byte)) return -1;
 
-#ifdef V8_INTERPRETED_REGEXP
-  // Byte-code regexp needs space allocated for all its registers.
-  // The result captures are copied to the start of the registers array
-  // if the match succeeds.  This way those registers are not clobbered
-  // when we set the last match info from last successful match.
-  return IrregexpNumberOfRegisters(FixedArray::cast(regexp->data())) +
-         (IrregexpNumberOfCaptures(FixedArray::cast(regexp->data())) + 1) * 2;
-#else  // V8_INTERPRETED_REGEXP
+  FixedArray* data = FixedArray::cast(regexp->data());
+  if (IrregexpIsInterpreted(data, is_one_byte)) {
+    // Byte-code regexp needs space allocated for all its registers.
+    // The result captures are copied to the start of the registers array
+    // if the match succeeds.  This way those registers are not clobbered
+    // when we set the last match info from last successful match.
+    return IrregexpNumberOfRegisters(data) +
+           (IrregexpNumberOfCaptures(data) + 1) * 2;
+  }
   // Native regexp only needs room to output captures. Registers are handled
   // internally.
-  return (IrregexpNumberOfCaptures(FixedArray::cast(regexp->data())) + 1) * 2;
-#endif  // V8_INTERPRETED_REGEXP
+  return (IrregexpNumberOfCaptures(data) + 1) * 2;
 }
 
 
@@ -463,46 +541,57 @@ int RegExpImpl::IrregexpExecRaw(Handle<JSRegExp> regexp,
   DCHECK_LE(index, subject->length());
   DCHECK(subject->IsFlat());
 
+  if (UsesNfa(regexp)) {
+    return RegExpNfa::Match(isolate, regexp, subject, index, output,
+                            output_size);
+  }
+
   bool is_one_byte = subject->IsOneByteRepresentationUnderneath();
 
 #ifndef V8_INTERPRETED_REGEXP
-  DCHECK(output_size >= (IrregexpNumberOfCaptures(*irregexp) + 1) * 2);
-  do {
-    EnsureCompiledIrregexp(regexp, subject, is_one_byte);
-    Handle<Code> code(IrregexpNativeCode(*irregexp, is_one_byte), isolate);
-    // The stack is used to allocate registers for the compiled regexp code.
-    // This means that in case of failure, the output registers array is left
-    // untouched and contains the capture results from the previous successful
-    // match.  We can use that to set the last match info lazily.
-    NativeRegExpMacroAssembler::Result res =
-        NativeRegExpMacroAssembler::Match(code,
-                                          subject,
-                                          output,
-                                          output_size,
-                                          index,
-                                          isolate);
-    if (res != NativeRegExpMacroAssembler::RETRY) {
-      DCHECK(res != NativeRegExpMacroAssembler::EXCEPTION ||
-             isolate->has_pending_exception());
-      STATIC_ASSERT(
-          static_cast<int>(NativeRegExpMacroAssembler::SUCCESS) == RE_SUCCESS);
-      STATIC_ASSERT(
-          static_cast<int>(NativeRegExpMacroAssembler::FAILURE) == RE_FAILURE);
-      STATIC_ASSERT(static_cast<int>(NativeRegExpMacroAssembler::EXCEPTION)
-                    == RE_EXCEPTION);
-      return static_cast<IrregexpResult>(res);
-    }
-    // If result is RETRY, the string has changed representation, and we
-    // must restart from scratch.
-    // In this case, it means we must make sure we are prepared to handle
-    // the, potentially, different subject (the string can switch between
-    // being internal and external, and even between being Latin1 and UC16,
-    // but the characters are always the same).
-    IrregexpPrepare(regexp, subject);
-    is_one_byte = subject->IsOneByteRepresentationUnderneath();
-  } while (true);
-  UNREACHABLE();
-#else  // V8_INTERPRETED_REGEXP
+  if (!IrregexpIsInterpreted(*irregexp, is_one_byte)) {
+    DCHECK(output_size >= (IrregexpNumberOfCaptures(*irregexp) + 1) * 2);
+    do {
+      EnsureCompiledIrregexp(regexp, subject, is_one_byte);
+      Handle<Code> code(IrregexpNativeCode(*irregexp, is_one_byte), isolate);
+      // The stack is used to allocate registers for the compiled regexp code.
+      // This means that in case of failure, the output registers array is left
+      // untouched and contains the capture results from the previous successful
+      // match.  We can use that to set the last match info lazily.
+      NativeRegExpMacroAssembler::Result res =
+          NativeRegExpMacroAssembler::Match(code,
+                                            subject,
+                                            output,
+                                            output_size,
+                                            index,
+                                            isolate);
+      if (res == NativeRegExpMacroAssembler::FALLBACK_TO_NFA) {
+        return IrregexpFallBackToNfa(regexp, subject, index, output,
+                                     output_size);
+      }
+      if (res != NativeRegExpMacroAssembler::RETRY) {
+        DCHECK(res != NativeRegExpMacroAssembler::EXCEPTION ||
+               isolate->has_pending_exception());
+        STATIC_ASSERT(static_cast<int>(NativeRegExpMacroAssembler::SUCCESS) ==
+                      RE_SUCCESS);
+        STATIC_ASSERT(static_cast<int>(NativeRegExpMacroAssembler::FAILURE) ==
+                      RE_FAILURE);
+        STATIC_ASSERT(static_cast<int>(NativeRegExpMacroAssembler::EXCEPTION) ==
+                      RE_EXCEPTION);
+        return static_cast<IrregexpResult>(res);
+      }
+      // If result is RETRY, the string has changed representation, and we
+      // must restart from scratch.
+      // In this case, it means we must make sure we are prepared to handle
+      // the, potentially, different subject (the string can switch between
+      // being internal and external, and even between being Latin1 and UC16,
+      // but the characters are always the same).
+      IrregexpPrepare(regexp, subject);
+      is_one_byte = subject->IsOneByteRepresentationUnderneath();
+    } while (true);
+    UNREACHABLE();
+  }
+#endif  // V8_INTERPRETED_REGEXP
 
   DCHECK(output_size >= IrregexpNumberOfRegisters(*irregexp));
   // We must have done EnsureCompiledIrregexp, so we can get the number of
@@ -510,20 +599,41 @@ int RegExpImpl::IrregexpExecRaw(Handle<JSRegExp> regexp,
   int number_of_capture_registers =
       (IrregexpNumberOfCaptures(*irregexp) + 1) * 2;
   int32_t* raw_output = &output[number_of_capture_registers];
-  // We do not touch the actual capture result registers until we know there
-  // has been a match so that we can use those capture results to set the
-  // last match info.
-  for (int i = number_of_capture_registers - 1; i >= 0; i--) {
-    raw_output[i] = -1;
-  }
-  Handle<ByteArray> byte_codes(IrregexpByteCode(*irregexp, is_one_byte),
-                               isolate);
-
-  IrregexpResult result = IrregexpInterpreter::Match(isolate,
-                                                     byte_codes,
-                                                     subject,
-                                                     raw_output,
-                                                     index);
+  IrregexpResult result;
+  do {
+    // We do not touch the actual capture result registers until we know
+    // there has been a match so that we can use those capture results to set
+    // the last match info.
+    for (int i = number_of_capture_registers - 1; i >= 0; i--) {
+      raw_output[i] = -1;
+    }
+    Handle<ByteArray> byte_codes(IrregexpByteCode(*irregexp, is_one_byte),
+                                 isolate);
+
+    result = IrregexpInterpreter::Match(isolate, byte_codes, subject,
+                                        raw_output, index,
+                                        IrregexpBacktrackLimit(*irregexp));
+    if (result != RE_RETRY) break;
+
+    // Handle the pending interrupt, which may run a GC or terminate
+    // execution, and restart from scratch. As for native code, the subject
+    // may have changed its representation in the meantime.
+    StackLimitCheck check(isolate);
+    if (check.JsHasOverflowed()) {
+      isolate->StackOverflow();
+      return RE_EXCEPTION;
+    }
+    if (isolate->stack_guard()->HandleInterrupts()->IsException(isolate)) {
+      return RE_EXCEPTION;
+    }
+    if (IrregexpPrepare(regexp, subject) < 0) return RE_EXCEPTION;
+    is_one_byte = subject->IsOneByteRepresentationUnderneath();
+    DCHECK(IrregexpIsInterpreted(*irregexp, is_one_byte));
+  } while (true);
+
+  if (result == RE_FALLBACK_TO_NFA) {
+    return IrregexpFallBackToNfa(regexp, subject, index, output, output_size);
+  }
   if (result == RE_SUCCESS) {
     // Copy capture results to the start of the registers array.
     MemCopy(output, raw_output, number_of_capture_registers * sizeof(int32_t));
@@ -533,7 +643,25 @@ int RegExpImpl::IrregexpExecRaw(Handle<JSRegExp> regexp,
     isolate->StackOverflow();
   }
   return result;
-#endif  // V8_INTERPRETED_REGEXP
+}
+
+int RegExpImpl::IrregexpFallBackToNfa(Handle<JSRegExp> regexp,
+                                      Handle<String> subject, int index,
+                                      int32_t* output, int output_size) {
+  Isolate* isolate = regexp->GetIsolate();
+  if (FLAG_trace_regexp_linear_fallback) {
+    PrintF("[regexp linear fallback: /%s/]\n",
+           regexp->Pattern()->ToCString().get());
+  }
+  if (!RegExpNfa::Compile(regexp)) return RE_EXCEPTION;
+  // The NFA program replaces the Irregexp code for both encodings for
+  // good, so the backtrack limit is not hit over and over again.
+  Smi* uninitialized = Smi::FromInt(JSRegExp::kUninitializedValue);
+  regexp->SetDataAt(JSRegExp::kIrregexpLatin1CodeIndex, uninitialized);
+  regexp->SetDataAt(JSRegExp::kIrregexpUC16CodeIndex, uninitialized);
+  isolate->counters()->regexp_linear_fallbacks()->Increment();
+  return RegExpNfa::Match(isolate, regexp, subject, index, output,
+                          output_size);
 }
 
 MaybeHandle<Object> RegExpImpl::IrregexpExec(
@@ -544,8 +672,10 @@ MaybeHandle<Object> RegExpImpl::IrregexpExec(
 
   subject = String::Flatten(subject);
 
+  TickIrregexpTierUp(regexp, subject->IsOneByteRepresentationUnderneath());
+
   // Prepare space for the return values.
-#if defined(V8_INTERPRETED_REGEXP) && defined(DEBUG)
+#ifdef DEBUG
   if (FLAG_trace_regexp_bytecodes) {
     String* pattern = regexp->Pattern();
     PrintF("\n\nRegexp match:   /%s/\n\n", pattern->ToCString().get());
@@ -626,23 +756,25 @@ RegExpImpl::GlobalCache::GlobalCache(Handle<JSRegExp> regexp,
       register_array_size_(0),
       regexp_(regexp),
       subject_(subject) {
-#ifdef V8_INTERPRETED_REGEXP
-  bool interpreted = true;
-#else
+  // There is no distinction between interpreted and native for atom regexps.
   bool interpreted = false;
-#endif  // V8_INTERPRETED_REGEXP
 
   if (regexp_->TypeTag() == JSRegExp::ATOM) {
     static const int kAtomRegistersPerMatch = 2;
     registers_per_match_ = kAtomRegistersPerMatch;
-    // There is no distinction between interpreted and native for atom regexps.
-    interpreted = false;
   } else {
+    bool is_one_byte = subject_->IsOneByteRepresentationUnderneath();
+    RegExpImpl::TickIrregexpTierUp(regexp_, is_one_byte);
     registers_per_match_ = RegExpImpl::IrregexpPrepare(regexp_, subject_);
     if (registers_per_match_ < 0) {
       num_matches_ = -1;  // Signal exception.
       return;
     }
+    // Like the interpreter, the linear-time engine finds a single match
+    // per call.
+    interpreted = RegExpImpl::UsesNfa(regexp_) ||
+                  RegExpImpl::IrregexpIsInterpreted(
+                      FixedArray::cast(regexp_->data()), is_one_byte);
   }
 
   DCHECK(IsGlobal(regexp->GetFlags()));
@@ -1107,7 +1239,7 @@ RegExpEngine::CompilationResult RegExpCompiler::Assemble(
   isolate->IncreaseTotalRegexpCodeGenerated(code->Size());
   work_list_ = nullptr;
 #if defined(ENABLE_DISASSEMBLER) && !defined(V8_INTERPRETED_REGEXP)
-  if (FLAG_print_code) {
+  if (FLAG_print_code && code->IsCode()) {
     CodeTracer::Scope trace_scope(isolate->GetCodeTracer());
     OFStream os(trace_scope.file());
     Handle<Code>::cast(code)->Disassemble(pattern->ToCString().get(), os);
@@ -3740,6 +3872,26 @@ int BoyerMooreLookahead::GetSkipTable(int min_lookahead,
 }
 
 
+// A match can only start at a position where the character at the given
+// offset is one of those in the bitmap for that offset. If the macro assembler
+// supports it, emit code that advances one character at a time, but many
+// characters per instruction, until such a position is reached. The scalar
+// loops emitted after this are still needed to handle the end of the subject.
+bool BoyerMooreLookahead::EmitVectorizedSkip(RegExpMacroAssembler* masm,
+                                             int offset) {
+  const int kSize = RegExpMacroAssembler::kTableSize;
+  BoyerMoorePositionInfo* map = bitmaps_->at(offset);
+  if (map->map_count() == 0 || map->map_count() == kSize) return false;
+  uc16 chars[kSize];
+  int count = 0;
+  for (int j = 0; j < kSize; j++) {
+    if (map->at(j)) chars[count++] = static_cast<uc16>(j);
+  }
+  return masm->SkipUntilCharacterInSet(offset, Vector<const uc16>(chars, count),
+                                       max_char_ > kSize);
+}
+
+
 // See comment above on the implementation of GetSkipTable.
 void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
   const int kSize = RegExpMacroAssembler::kTableSize;
@@ -3770,11 +3922,15 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
   int lookahead_width = max_lookahead + 1 - min_lookahead;
 
   if (found_single_character && lookahead_width == 1 && max_lookahead < 3) {
-    // The mask-compare can probably handle this better.
+    // The mask-compare can probably handle this better, but finding the next
+    // occurrence of the character with vector instructions first still pays
+    // off on long subjects.
+    EmitVectorizedSkip(masm, max_lookahead);
     return;
   }
 
   if (found_single_character) {
+    EmitVectorizedSkip(masm, max_lookahead);
     Label cont, again;
     masm->Bind(&again);
     masm->LoadCurrentCharacter(max_lookahead, &cont, true);
@@ -3797,6 +3953,14 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
       min_lookahead, max_lookahead, boolean_skip_table);
   DCHECK_NE(0, skip_distance);
 
+  // The position in the interval with the fewest possible characters is the
+  // best candidate for a vectorized search that precedes the table lookups.
+  int vector_offset = max_lookahead;
+  for (int i = max_lookahead - 1; i >= min_lookahead; i--) {
+    if (Count(i) < Count(vector_offset)) vector_offset = i;
+  }
+  EmitVectorizedSkip(masm, vector_offset);
+
   Label cont, again;
   masm->Bind(&again);
   masm->LoadCurrentCharacter(max_lookahead, &cont, true);
@@ -6655,7 +6819,8 @@ RegExpNode* OptionallyStepBackToLeadSurrogate(RegExpCompiler* compiler,
 RegExpEngine::CompilationResult RegExpEngine::Compile(
     Isolate* isolate, Zone* zone, RegExpCompileData* data,
     JSRegExp::Flags flags, Handle<String> pattern,
-    Handle<String> sample_subject, bool is_one_byte) {
+    Handle<String> sample_subject, bool is_one_byte, bool use_bytecode,
+    int backtrack_limit) {
   if ((data->capture_count + 1) * 2 - 1 > RegExpMacroAssembler::kMaxRegister) {
     return IrregexpRegExpTooBig(isolate);
   }
@@ -6730,55 +6895,61 @@ RegExpEngine::CompilationResult RegExpEngine::Compile(
   }
 
   // Create the correct assembler for the architecture.
+  std::unique_ptr<RegExpMacroAssembler> macro_assembler;
+  EmbeddedVector<byte, 1024> codes;
+  if (use_bytecode) {
+    // Interpreted regexp implementation.
+    macro_assembler.reset(
+        new RegExpMacroAssemblerIrregexp(isolate, codes, zone));
+  } else {
 #ifndef V8_INTERPRETED_REGEXP
-  // Native regexp implementation.
-
-  NativeRegExpMacroAssembler::Mode mode =
-      is_one_byte ? NativeRegExpMacroAssembler::LATIN1
-                  : NativeRegExpMacroAssembler::UC16;
+    // Native regexp implementation.
+    NativeRegExpMacroAssembler::Mode mode =
+        is_one_byte ? NativeRegExpMacroAssembler::LATIN1
+                    : NativeRegExpMacroAssembler::UC16;
+    int output_registers = (data->capture_count + 1) * 2;
 
 #if V8_TARGET_ARCH_IA32
-  RegExpMacroAssemblerIA32 macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.reset(
+        new RegExpMacroAssemblerIA32(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_X64
-  RegExpMacroAssemblerX64 macro_assembler(isolate, zone, mode,
-                                          (data->capture_count + 1) * 2);
+    macro_assembler.reset(
+        new RegExpMacroAssemblerX64(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_ARM
-  RegExpMacroAssemblerARM macro_assembler(isolate, zone, mode,
-                                          (data->capture_count + 1) * 2);
+    macro_assembler.reset(
+        new RegExpMacroAssemblerARM(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_ARM64
-  RegExpMacroAssemblerARM64 macro_assembler(isolate, zone, mode,
-                                            (data->capture_count + 1) * 2);
+    macro_assembler.reset(
+        new RegExpMacroAssemblerARM64(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_S390
-  RegExpMacroAssemblerS390 macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.reset(
+        new RegExpMacroAssemblerS390(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_PPC
-  RegExpMacroAssemblerPPC macro_assembler(isolate, zone, mode,
-                                          (data->capture_count + 1) * 2);
+    macro_assembler.reset(
+        new RegExpMacroAssemblerPPC(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_MIPS
-  RegExpMacroAssemblerMIPS macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.reset(
+        new RegExpMacroAssemblerMIPS(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_MIPS64
-  RegExpMacroAssemblerMIPS macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.reset(
+        new RegExpMacroAssemblerMIPS(isolate, zone, mode, output_registers));
 #else
 #error "Unsupported architecture"
 #endif
-
 #else  // V8_INTERPRETED_REGEXP
-  // Interpreted regexp implementation.
-  EmbeddedVector<byte, 1024> codes;
-  RegExpMacroAssemblerIrregexp macro_assembler(isolate, codes, zone);
+    UNREACHABLE();
 #endif  // V8_INTERPRETED_REGEXP
+  }
 
-  macro_assembler.set_slow_safe(TooMuchRegExpCode(pattern));
+  macro_assembler->set_slow_safe(TooMuchRegExpCode(pattern));
+  macro_assembler->set_backtrack_limit(backtrack_limit);
 
   // Inserted here, instead of in Assembler, because it depends on information
   // in the AST that isn't replicated in the Node structure.
   static const int kMaxBacksearchLimit = 1024;
   if (is_end_anchored && !is_start_anchored && !is_sticky &&
       max_length < kMaxBacksearchLimit) {
-    macro_assembler.SetCurrentPositionFromEnd(max_length);
+    macro_assembler->SetCurrentPositionFromEnd(max_length);
   }
 
   if (is_global) {
@@ -6788,10 +6959,10 @@ RegExpEngine::CompilationResult RegExpEngine::Compile(
     } else if (is_unicode) {
       mode = RegExpMacroAssembler::GLOBAL_UNICODE;
     }
-    macro_assembler.set_global_mode(mode);
+    macro_assembler->set_global_mode(mode);
   }
 
-  return compiler.Assemble(&macro_assembler,
+  return compiler.Assemble(macro_assembler.get(),
                            node,
                            data->capture_count,
                            pattern);
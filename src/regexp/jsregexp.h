@@ -46,6 +46,10 @@ inline bool Multiline(JSRegExp::Flags flags) {
   return (flags & JSRegExp::kMultiline) != 0;
 }
 
+inline bool IsLinear(JSRegExp::Flags flags) {
+  return (flags & JSRegExp::kLinear) != 0;
+}
+
 inline bool NeedsUnicodeCaseEquivalents(JSRegExp::Flags flags) {
   // Both unicode and ignore_case flags are set. We need to use ICU to find
   // the closure over case equivalents.
@@ -104,7 +108,15 @@ class RegExpImpl {
                                  Handle<String> subject, int index,
                                  Handle<RegExpMatchInfo> last_match_info);
 
-  enum IrregexpResult { RE_FAILURE = 0, RE_SUCCESS = 1, RE_EXCEPTION = -1 };
+  enum IrregexpResult {
+    RE_FAILURE = 0,
+    RE_SUCCESS = 1,
+    RE_EXCEPTION = -1,
+    // Only used internally: the interpreter stopped for an interrupt.
+    RE_RETRY = -2,
+    // Only used internally: the backtrack limit was exceeded.
+    RE_FALLBACK_TO_NFA = -3
+  };
 
   // Prepare a RegExp for being executed one or more times (using
   // IrregexpExecOnce) on the subject.
@@ -183,6 +195,19 @@ class RegExpImpl {
   static int IrregexpNumberOfRegisters(FixedArray* re);
   static ByteArray* IrregexpByteCode(FixedArray* re, bool is_one_byte);
   static Code* IrregexpNativeCode(FixedArray* re, bool is_one_byte);
+  static int IrregexpTicksUntilTierUp(FixedArray* re);
+  static void SetIrregexpTicksUntilTierUp(FixedArray* re, int value);
+
+  static int IrregexpBacktrackLimit(FixedArray* re);
+  static void SetIrregexpBacktrackLimit(FixedArray* re, int value);
+
+  // Whether the code for the given subject encoding is bytecode for the
+  // interpreter (as opposed to native code). The regexp must be compiled.
+  static bool IrregexpIsInterpreted(FixedArray* re, bool is_one_byte);
+
+  // Whether the regexp is matched by the linear-time engine, either because
+  // of its flags or after exceeding its backtrack limit.
+  static bool UsesNfa(Handle<JSRegExp> re);
 
   // Limit the space regexps take up on the heap.  In order to limit this we
   // would like to keep track of the amount of regexp code on the heap.  This
@@ -199,6 +224,16 @@ class RegExpImpl {
   static inline bool EnsureCompiledIrregexp(Handle<JSRegExp> re,
                                             Handle<String> sample_subject,
                                             bool is_one_byte);
+  // Counts an execution of interpreted bytecode towards tier-up and, once
+  // the regexp has become hot, discards the bytecode so that the next
+  // compilation produces native code. Called once per exec or global
+  // operation, before IrregexpPrepare.
+  static void TickIrregexpTierUp(Handle<JSRegExp> re, bool is_one_byte);
+  // Replaces the Irregexp code with a program for the linear-time engine
+  // and redoes the match attempt that exceeded the backtrack limit.
+  static int IrregexpFallBackToNfa(Handle<JSRegExp> regexp,
+                                   Handle<String> subject, int index,
+                                   int32_t* output, int output_size);
 };
 
 
@@ -1212,6 +1247,7 @@ class BoyerMooreLookahead : public ZoneObject {
                    int max_lookahead,
                    Handle<ByteArray> boolean_skip_table);
   bool FindWorthwhileInterval(int* from, int* to);
+  bool EmitVectorizedSkip(RegExpMacroAssembler* masm, int offset);
   int FindBestInterval(
     int max_number_of_chars, int old_biggest_points, int* from, int* to);
 };
@@ -1528,12 +1564,17 @@ class RegExpEngine: public AllStatic {
     int num_registers;
   };
 
+  // Generates bytecode for the interpreter if |use_bytecode| is set, and
+  // native code for the target architecture otherwise. Native code that
+  // supports it gives up after |backtrack_limit| backtracks, unless the
+  // limit is zero.
   static CompilationResult Compile(Isolate* isolate, Zone* zone,
                                    RegExpCompileData* input,
                                    JSRegExp::Flags flags,
                                    Handle<String> pattern,
                                    Handle<String> sample_subject,
-                                   bool is_one_byte);
+                                   bool is_one_byte, bool use_bytecode,
+                                   int backtrack_limit);
 
   static bool TooMuchRegExpCode(Handle<String> pattern);
 
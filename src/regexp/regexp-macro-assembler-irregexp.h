@@ -5,8 +5,6 @@
 #ifndef V8_REGEXP_REGEXP_MACRO_ASSEMBLER_IRREGEXP_H_
 #define V8_REGEXP_REGEXP_MACRO_ASSEMBLER_IRREGEXP_H_
 
-#ifdef V8_INTERPRETED_REGEXP
-
 #include "src/regexp/regexp-macro-assembler.h"
 
 namespace v8 {
@@ -105,7 +103,7 @@ class RegExpMacroAssemblerIrregexp: public RegExpMacroAssembler {
   inline void Emit(uint32_t bc, uint32_t arg);
   // Bytecode buffer.
   int length();
-  void Copy(Address a);
+  void Copy(byte* a);
 
   // The buffer into which code and relocation info are generated.
   Vector<byte> buffer_;
@@ -129,6 +127,4 @@ class RegExpMacroAssemblerIrregexp: public RegExpMacroAssembler {
 }  // namespace internal
 }  // namespace v8
 
-#endif  // V8_INTERPRETED_REGEXP
-
 #endif  // V8_REGEXP_REGEXP_MACRO_ASSEMBLER_IRREGEXP_H_
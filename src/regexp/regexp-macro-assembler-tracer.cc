@@ -351,6 +351,20 @@ void RegExpMacroAssemblerTracer::CheckBitInTable(
 }
 
 
+bool RegExpMacroAssemblerTracer::SkipUntilCharacterInSet(
+    int cp_offset, Vector<const uc16> chars, bool mask_to_table_size) {
+  bool supported = assembler_->SkipUntilCharacterInSet(cp_offset, chars,
+                                                       mask_to_table_size);
+  PrintF(" SkipUntilCharacterInSet(cp_offset=%d, chars=", cp_offset);
+  for (int i = 0; i < chars.length(); i++) {
+    PrintF("%s0x%04x", i == 0 ? "" : ",", chars[i]);
+  }
+  PrintF("%s): %s;\n", mask_to_table_size ? ", masked" : "",
+         supported ? "true" : "false");
+  return supported;
+}
+
+
 void RegExpMacroAssemblerTracer::CheckNotBackReference(int start_reg,
                                                        bool read_backward,
                                                        Label* on_no_match) {
@@ -111,6 +111,19 @@ class RegExpMacroAssembler {
   // array, and if the found byte is non-zero, we jump to the on_bit_set label.
   virtual void CheckBitInTable(Handle<ByteArray> table, Label* on_bit_set) = 0;
 
+  // Advances the current position one character at a time while the
+  // character at cp_offset from it (modulus the kTableSize if
+  // |mask_to_table_size| is set) is none of |chars|, typically many
+  // characters per iteration. This is only an accelerator for a loop that
+  // the caller emits after it: it may stop before reaching such a position,
+  // e.g. close to the end of the input, but never steps over one or reads
+  // beyond the input. Returns false if no code is emitted because the
+  // character set is too large or the platform has no support for it.
+  virtual bool SkipUntilCharacterInSet(int cp_offset, Vector<const uc16> chars,
+                                       bool mask_to_table_size) {
+    return false;
+  }
+
   // Checks whether the given offset from the current position is before
   // the end of the string.  May overwrite the current character.
   virtual void CheckPosition(int cp_offset, Label* on_outside_input);
@@ -182,12 +195,20 @@ class RegExpMacroAssembler {
   }
   inline bool global_unicode() { return global_mode_ == GLOBAL_UNICODE; }
 
+  // Bound on the number of backtracks a single match attempt may perform
+  // before giving up and asking the caller to use the linear-time engine
+  // instead. Zero means no limit. Only honored by some backends.
+  void set_backtrack_limit(int limit) { backtrack_limit_ = limit; }
+  int backtrack_limit() const { return backtrack_limit_; }
+  bool has_backtrack_limit() const { return backtrack_limit_ != 0; }
+
   Isolate* isolate() const { return isolate_; }
   Zone* zone() const { return zone_; }
 
  private:
   bool slow_safe_compiler_;
   GlobalMode global_mode_;
+  int backtrack_limit_;
   Isolate* isolate_;
   Zone* zone_;
 };
@@ -209,7 +230,15 @@ class NativeRegExpMacroAssembler: public RegExpMacroAssembler {
   // FAILURE: Matching failed.
   // SUCCESS: Matching succeeded, and the output array has been filled with
   //        capture positions.
-  enum Result { RETRY = -2, EXCEPTION = -1, FAILURE = 0, SUCCESS = 1 };
+  // FALLBACK_TO_NFA: The backtrack limit was exceeded, and the match should
+  //        be redone with the linear-time engine.
+  enum Result {
+    FALLBACK_TO_NFA = -3,
+    RETRY = -2,
+    EXCEPTION = -1,
+    FAILURE = 0,
+    SUCCESS = 1
+  };
 
   NativeRegExpMacroAssembler(Isolate* isolate, Zone* zone);
   virtual ~NativeRegExpMacroAssembler();
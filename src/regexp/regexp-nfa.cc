@@ -0,0 +1,561 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-nfa.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "src/char-predicates-inl.h"
+#include "src/heap/factory.h"
+#include "src/isolate.h"
+#include "src/objects-inl.h"
+#include "src/regexp/regexp-ast.h"
+#include "src/regexp/regexp-parser.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// The NFA program is a sequence of fixed-size instructions. Threads of the
+// simulation only ever wait at CONSUME_CHAR and CONSUME_CLASS instructions;
+// all other instructions are followed eagerly when a thread is added.
+enum Opcode : int32_t {
+  // Consume the character |a|.
+  CONSUME_CHAR,
+  // Consume a character in one of the |a| ranges that follow.
+  CONSUME_CLASS,
+  // A range [a, b] of a CONSUME_CLASS. Never executed.
+  RANGE,
+  // Continue only if the RegExpAssertion::AssertionType |a| holds.
+  ASSERTION,
+  // Reset the registers |a| to |b| (inclusive) to -1.
+  CLEAR_REGISTERS,
+  // Store the current position in register |a|.
+  SET_REGISTER_TO_CP,
+  // Continue at the next instruction and, with lower priority, at |a|.
+  FORK,
+  // Continue at |a|.
+  JMP,
+  // A match has been found.
+  ACCEPT
+};
+
+struct Instruction {
+  int32_t opcode;
+  int32_t a;
+  int32_t b;
+};
+
+// Upper bound on the number of registers kept alive by a single match
+// attempt, summed over all threads.
+const int kMaxThreadRegisters = 1 * MB;
+
+// Translates a regexp parse tree to an NFA program. Compilation fails if the
+// tree uses features that need backtracking or nests too deeply to be
+// walked on the C++ stack.
+class NfaCompiler final : private RegExpVisitor {
+ public:
+  NfaCompiler(Isolate* isolate, Zone* zone)
+      : isolate_(isolate), zone_(zone), code_(64, zone) {}
+
+  bool Compile(RegExpTree* tree, JSRegExp::Flags flags, int capture_count) {
+    if (IgnoreCase(flags) || IsUnicode(flags)) return false;
+    ok_ = true;
+    Emit(SET_REGISTER_TO_CP, RegExpCapture::StartRegister(0));
+    Visit(tree);
+    Emit(SET_REGISTER_TO_CP, RegExpCapture::EndRegister(0));
+    Emit(ACCEPT);
+    if (!ok_) return false;
+
+    // Every thread waits at a distinct consuming instruction, and the stack
+    // of pending threads holds at most one entry per FORK.
+    int thread_slots = 1;
+    for (int i = 0; i < code_.length(); i++) {
+      Opcode opcode = static_cast<Opcode>(code_[i].opcode);
+      if (opcode == CONSUME_CHAR || opcode == CONSUME_CLASS) {
+        thread_slots += 2;
+      } else if (opcode == FORK) {
+        thread_slots++;
+      }
+    }
+    int register_count = (capture_count + 1) * 2;
+    return thread_slots <= kMaxThreadRegisters / register_count;
+  }
+
+  const ZoneList<Instruction>& code() const { return code_; }
+
+ private:
+  int pc() const { return code_.length(); }
+
+  void Emit(Opcode opcode, int a = 0, int b = 0) {
+    if (code_.length() >= RegExpNfa::kMaxProgramLength) {
+      ok_ = false;
+      return;
+    }
+    code_.Add({opcode, a, b}, zone_);
+  }
+
+  void Visit(RegExpTree* tree) {
+    StackLimitCheck check(isolate_);
+    if (check.HasOverflowed()) {
+      ok_ = false;
+      return;
+    }
+    tree->Accept(this, nullptr);
+  }
+
+  // Sets the target of the FORK or JMP at |pc| to the current position.
+  void PatchTarget(int pc) {
+    if (!ok_) return;
+    DCHECK(code_[pc].opcode == FORK || code_[pc].opcode == JMP);
+    code_[pc].a = this->pc();
+  }
+
+  void* VisitDisjunction(RegExpDisjunction* node, void*) override {
+    ZoneList<RegExpTree*>* alternatives = node->alternatives();
+    ZoneList<int> jumps_to_end(alternatives->length(), zone_);
+    for (int i = 0; i < alternatives->length() - 1 && ok_; i++) {
+      // Earlier alternatives take precedence.
+      int fork = pc();
+      Emit(FORK);
+      Visit(alternatives->at(i));
+      jumps_to_end.Add(pc(), zone_);
+      Emit(JMP);
+      PatchTarget(fork);
+    }
+    Visit(alternatives->last());
+    for (int i = 0; i < jumps_to_end.length(); i++) {
+      PatchTarget(jumps_to_end[i]);
+    }
+    return nullptr;
+  }
+
+  void* VisitAlternative(RegExpAlternative* node, void*) override {
+    ZoneList<RegExpTree*>* nodes = node->nodes();
+    for (int i = 0; i < nodes->length() && ok_; i++) {
+      Visit(nodes->at(i));
+    }
+    return nullptr;
+  }
+
+  void* VisitAssertion(RegExpAssertion* node, void*) override {
+    Emit(ASSERTION, node->assertion_type());
+    return nullptr;
+  }
+
+  void* VisitCharacterClass(RegExpCharacterClass* node, void*) override {
+    if (IgnoreCase(node->flags()) || IsUnicode(node->flags())) {
+      ok_ = false;
+      return nullptr;
+    }
+    ZoneList<CharacterRange>* ranges = node->ranges(zone_);
+    ZoneList<CharacterRange>* canonical =
+        new (zone_) ZoneList<CharacterRange>(ranges->length(), zone_);
+    canonical->AddAll(*ranges, zone_);
+    CharacterRange::Canonicalize(canonical);
+    if (node->is_negated()) {
+      ZoneList<CharacterRange>* negated =
+          new (zone_) ZoneList<CharacterRange>(canonical->length() + 1, zone_);
+      CharacterRange::Negate(canonical, negated, zone_);
+      canonical = negated;
+    }
+    // Subjects are sequences of UTF-16 code units.
+    int count = 0;
+    for (int i = 0; i < canonical->length(); i++) {
+      if (canonical->at(i).from() <= String::kMaxUtf16CodeUnit) count++;
+    }
+    Emit(CONSUME_CLASS, count);
+    for (int i = 0; i < count; i++) {
+      CharacterRange range = canonical->at(i);
+      Emit(RANGE, range.from(),
+           Min(range.to(), static_cast<uc32>(String::kMaxUtf16CodeUnit)));
+    }
+    return nullptr;
+  }
+
+  void* VisitAtom(RegExpAtom* node, void*) override {
+    if (IgnoreCase(node->flags()) || IsUnicode(node->flags())) {
+      ok_ = false;
+      return nullptr;
+    }
+    Vector<const uc16> data = node->data();
+    for (int i = 0; i < data.length(); i++) Emit(CONSUME_CHAR, data[i]);
+    return nullptr;
+  }
+
+  void* VisitText(RegExpText* node, void*) override {
+    ZoneList<TextElement>* elements = node->elements();
+    for (int i = 0; i < elements->length() && ok_; i++) {
+      Visit(elements->at(i).tree());
+    }
+    return nullptr;
+  }
+
+  // One iteration of a quantifier. Captures in the body are reset before
+  // each iteration.
+  void EmitQuantifierBody(RegExpQuantifier* node) {
+    Interval captures = node->body()->CaptureRegisters();
+    if (!captures.is_empty()) {
+      Emit(CLEAR_REGISTERS, captures.from(), captures.to());
+    }
+    Visit(node->body());
+  }
+
+  void* VisitQuantifier(RegExpQuantifier* node, void*) override {
+    // Optional iterations of a body that can match the empty string need
+    // the empty check of the specification, which depends on more state
+    // than the position in the program and subject.
+    if (node->is_possessive() ||
+        (node->body()->min_match() == 0 && node->max() > node->min())) {
+      ok_ = false;
+      return nullptr;
+    }
+    for (int i = 0; i < node->min() && ok_; i++) EmitQuantifierBody(node);
+    if (node->max() == RegExpTree::kInfinity) {
+      int loop = pc();
+      int fork = loop;
+      Emit(FORK);
+      if (node->is_greedy()) {
+        EmitQuantifierBody(node);
+        Emit(JMP, loop);
+        PatchTarget(fork);
+      } else {
+        int jump_to_end = pc();
+        Emit(JMP);
+        PatchTarget(fork);
+        EmitQuantifierBody(node);
+        Emit(JMP, loop);
+        PatchTarget(jump_to_end);
+      }
+    } else {
+      ZoneList<int> jumps_to_end(2, zone_);
+      for (int i = node->min(); i < node->max() && ok_; i++) {
+        int fork = pc();
+        Emit(FORK);
+        if (node->is_greedy()) {
+          jumps_to_end.Add(fork, zone_);
+        } else {
+          jumps_to_end.Add(pc(), zone_);
+          Emit(JMP);
+          PatchTarget(fork);
+        }
+        EmitQuantifierBody(node);
+      }
+      for (int i = 0; i < jumps_to_end.length(); i++) {
+        PatchTarget(jumps_to_end[i]);
+      }
+    }
+    return nullptr;
+  }
+
+  void* VisitCapture(RegExpCapture* node, void*) override {
+    Emit(SET_REGISTER_TO_CP, RegExpCapture::StartRegister(node->index()));
+    Visit(node->body());
+    Emit(SET_REGISTER_TO_CP, RegExpCapture::EndRegister(node->index()));
+    return nullptr;
+  }
+
+  void* VisitGroup(RegExpGroup* node, void*) override {
+    Visit(node->body());
+    return nullptr;
+  }
+
+  void* VisitLookaround(RegExpLookaround* node, void*) override {
+    ok_ = false;
+    return nullptr;
+  }
+
+  void* VisitBackReference(RegExpBackReference* node, void*) override {
+    ok_ = false;
+    return nullptr;
+  }
+
+  void* VisitEmpty(RegExpEmpty* node, void*) override { return nullptr; }
+
+  Isolate* isolate_;
+  Zone* zone_;
+  ZoneList<Instruction> code_;
+  bool ok_ = true;
+};
+
+bool IsLineTerminator(uc32 c) {
+  return c == '\n' || c == '\r' || c == 0x2028 || c == 0x2029;
+}
+
+bool IsWordCharacter(uc32 c) {
+  return IsInRange(AsciiAlphaToLower(c), 'a', 'z') || IsDecimalDigit(c) ||
+         c == '_';
+}
+
+// Simulates the NFA on all start positions at once. Threads are kept in
+// priority order, i.e. in the order a backtracking engine would explore
+// them, and a thread is dropped if a higher-priority one has already
+// reached the same instruction at the same position: both would behave
+// identically from there on. Each subject character is thus looked at
+// by at most one thread per instruction.
+template <typename Char>
+class NfaInterpreter {
+ public:
+  NfaInterpreter(const Instruction* code, int code_length,
+                 Vector<const Char> subject, int register_count)
+      : code_(code),
+        subject_(subject),
+        register_count_(register_count),
+        visited_(code_length, -1),
+        registers_(register_count),
+        best_match_(register_count) {}
+
+  bool FindMatch(int index, bool sticky, int32_t* output) {
+    ThreadList threads(register_count_), next_threads(register_count_);
+    std::vector<int32_t> initial_registers(register_count_, -1);
+    for (int position = index;; position++) {
+      // A new attempt starting here has lower priority than all attempts
+      // that started earlier.
+      if (!matched_ && (position == index || !sticky)) {
+        AddThread(&threads, 0, initial_registers.data(), position);
+      }
+      if (position == subject_.length()) break;
+      if (threads.is_empty() && (matched_ || sticky)) break;
+
+      uc32 c = subject_[position];
+      next_threads.Clear();
+      for (int i = 0; i < threads.length(); i++) {
+        int pc = threads.pc(i);
+        if (!Consumes(pc, c)) continue;
+        int next_pc = code_[pc].opcode == CONSUME_CHAR ? pc + 1
+                                                       : pc + 1 + code_[pc].a;
+        // A match cuts off all threads of lower priority.
+        if (AddThread(&next_threads, next_pc, threads.registers(i),
+                      position + 1)) {
+          break;
+        }
+      }
+      std::swap(threads, next_threads);
+    }
+    if (!matched_) return false;
+    std::copy(best_match_.begin(), best_match_.end(), output);
+    return true;
+  }
+
+ private:
+  class ThreadList {
+   public:
+    explicit ThreadList(int register_count)
+        : register_count_(register_count) {}
+    void Add(int pc, const int32_t* registers) {
+      pcs_.push_back(pc);
+      registers_.insert(registers_.end(), registers,
+                        registers + register_count_);
+    }
+    void Clear() {
+      pcs_.clear();
+      registers_.clear();
+    }
+    bool is_empty() const { return pcs_.empty(); }
+    int length() const { return static_cast<int>(pcs_.size()); }
+    int pc(int i) const { return pcs_[i]; }
+    const int32_t* registers(int i) const {
+      return registers_.data() + i * register_count_;
+    }
+
+   private:
+    int register_count_;
+    std::vector<int> pcs_;
+    std::vector<int32_t> registers_;
+  };
+
+  bool Consumes(int pc, uc32 c) const {
+    const Instruction& insn = code_[pc];
+    if (insn.opcode == CONSUME_CHAR) return static_cast<uc32>(insn.a) == c;
+    DCHECK_EQ(CONSUME_CLASS, insn.opcode);
+    for (int i = 1; i <= insn.a; i++) {
+      const Instruction& range = code_[pc + i];
+      DCHECK_EQ(RANGE, range.opcode);
+      if (static_cast<uc32>(range.a) <= c && c <= static_cast<uc32>(range.b)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool CheckAssertion(RegExpAssertion::AssertionType type,
+                      int position) const {
+    int length = subject_.length();
+    switch (type) {
+      case RegExpAssertion::START_OF_INPUT:
+        return position == 0;
+      case RegExpAssertion::END_OF_INPUT:
+        return position == length;
+      case RegExpAssertion::START_OF_LINE:
+        return position == 0 || IsLineTerminator(subject_[position - 1]);
+      case RegExpAssertion::END_OF_LINE:
+        return position == length || IsLineTerminator(subject_[position]);
+      case RegExpAssertion::BOUNDARY:
+      case RegExpAssertion::NON_BOUNDARY: {
+        bool before = position > 0 && IsWordCharacter(subject_[position - 1]);
+        bool after =
+            position < length && IsWordCharacter(subject_[position]);
+        return (before != after) == (type == RegExpAssertion::BOUNDARY);
+      }
+    }
+    UNREACHABLE();
+  }
+
+  // Follows all non-consuming instructions from |pc| and adds the threads
+  // that end up waiting for a character to |list|, in priority order.
+  // Returns true if a match has been found, in which case threads of lower
+  // priority have not been added.
+  bool AddThread(ThreadList* list, int pc, const int32_t* registers,
+                 int position) {
+    std::copy(registers, registers + register_count_, registers_.begin());
+    DCHECK(stack_pcs_.empty());
+    while (true) {
+      bool alive = true;
+      while (alive) {
+        if (visited_[pc] == position) break;
+        visited_[pc] = position;
+        const Instruction& insn = code_[pc];
+        switch (insn.opcode) {
+          case CONSUME_CHAR:
+          case CONSUME_CLASS:
+            list->Add(pc, registers_.data());
+            alive = false;
+            break;
+          case ASSERTION:
+            alive = CheckAssertion(
+                static_cast<RegExpAssertion::AssertionType>(insn.a), position);
+            pc++;
+            break;
+          case CLEAR_REGISTERS:
+            std::fill(registers_.begin() + insn.a,
+                      registers_.begin() + insn.b + 1, -1);
+            pc++;
+            break;
+          case SET_REGISTER_TO_CP:
+            registers_[insn.a] = position;
+            pc++;
+            break;
+          case FORK:
+            stack_pcs_.push_back(insn.a);
+            stack_registers_.insert(stack_registers_.end(), registers_.begin(),
+                                    registers_.end());
+            pc++;
+            break;
+          case JMP:
+            pc = insn.a;
+            break;
+          case ACCEPT:
+            matched_ = true;
+            best_match_ = registers_;
+            stack_pcs_.clear();
+            stack_registers_.clear();
+            return true;
+          default:
+            UNREACHABLE();
+        }
+      }
+      if (stack_pcs_.empty()) return false;
+      pc = stack_pcs_.back();
+      stack_pcs_.pop_back();
+      auto top = stack_registers_.end() - register_count_;
+      std::copy(top, stack_registers_.end(), registers_.begin());
+      stack_registers_.erase(top, stack_registers_.end());
+    }
+  }
+
+  const Instruction* code_;
+  Vector<const Char> subject_;
+  int register_count_;
+  // The position at which each instruction was last reached.
+  std::vector<int> visited_;
+  // Registers of the thread currently being advanced.
+  std::vector<int32_t> registers_;
+  // Threads of lower priority waiting to be advanced by AddThread.
+  std::vector<int> stack_pcs_;
+  std::vector<int32_t> stack_registers_;
+  bool matched_ = false;
+  std::vector<int32_t> best_match_;
+};
+
+template <typename Char>
+bool RawMatch(const Instruction* code, int code_length,
+              Vector<const Char> subject, int index, bool sticky,
+              int32_t* output, int register_count) {
+  NfaInterpreter<Char> interpreter(code, code_length, subject, register_count);
+  return interpreter.FindMatch(index, sticky, output);
+}
+
+}  // namespace
+
+// static
+bool RegExpNfa::CanBeHandled(Isolate* isolate, Zone* zone, RegExpTree* tree,
+                             JSRegExp::Flags flags, int capture_count) {
+  NfaCompiler compiler(isolate, zone);
+  return compiler.Compile(tree, flags, capture_count);
+}
+
+// static
+bool RegExpNfa::Compile(Handle<JSRegExp> regexp) {
+  Isolate* isolate = regexp->GetIsolate();
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  Handle<String> pattern = String::Flatten(handle(regexp->Pattern(), isolate));
+  JSRegExp::Flags flags = regexp->GetFlags();
+  RegExpCompileData parse_result;
+  FlatStringReader reader(isolate, pattern);
+  // The pattern has been parsed successfully before.
+  CHECK(RegExpParser::ParseRegExp(isolate, &zone, &reader, flags,
+                                  &parse_result));
+  NfaCompiler compiler(isolate, &zone);
+  if (!compiler.Compile(parse_result.tree, flags, parse_result.capture_count)) {
+    // The pattern was supported when it was checked, so we ran out of stack.
+    isolate->StackOverflow();
+    return false;
+  }
+
+  const ZoneList<Instruction>& code = compiler.code();
+  int size = code.length() * static_cast<int>(sizeof(Instruction));
+  Handle<ByteArray> program = isolate->factory()->NewByteArray(size, TENURED);
+  program->copy_in(0, reinterpret_cast<const byte*>(&code[0]), size);
+
+  FixedArray* data = FixedArray::cast(regexp->data());
+  data->set(JSRegExp::kIrregexpNfaProgramIndex, *program);
+  RegExpImpl::SetIrregexpCaptureNameMap(data, parse_result.capture_name_map);
+  return true;
+}
+
+// static
+RegExpImpl::IrregexpResult RegExpNfa::Match(Isolate* isolate,
+                                            Handle<JSRegExp> regexp,
+                                            Handle<String> subject, int index,
+                                            int32_t* output, int output_size) {
+  DCHECK(subject->IsFlat());
+  DisallowHeapAllocation no_gc;
+  FixedArray* data = FixedArray::cast(regexp->data());
+  ByteArray* program =
+      ByteArray::cast(data->get(JSRegExp::kIrregexpNfaProgramIndex));
+  const Instruction* code =
+      reinterpret_cast<const Instruction*>(program->GetDataStartAddress());
+  int code_length = program->length() / static_cast<int>(sizeof(Instruction));
+  int register_count = (RegExpImpl::IrregexpNumberOfCaptures(data) + 1) * 2;
+  DCHECK_LE(register_count, output_size);
+  USE(output_size);
+  bool sticky = IsSticky(regexp->GetFlags());
+
+  bool matched;
+  String::FlatContent content = subject->GetFlatContent();
+  if (content.IsOneByte()) {
+    matched = RawMatch(code, code_length, content.ToOneByteVector(), index,
+                       sticky, output, register_count);
+  } else {
+    DCHECK(content.IsTwoByte());
+    matched = RawMatch(code, code_length, content.ToUC16Vector(), index,
+                       sticky, output, register_count);
+  }
+  return matched ? RegExpImpl::RE_SUCCESS : RegExpImpl::RE_FAILURE;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,53 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_NFA_H_
+#define V8_REGEXP_REGEXP_NFA_H_
+
+#include "src/regexp/jsregexp.h"
+
+namespace v8 {
+namespace internal {
+
+class RegExpTree;
+
+// A linear-time matching engine for the subset of regexps that do not need
+// backtracking: no back references, no lookarounds, and neither
+// case-insensitive nor unicode matching. The pattern is compiled to a
+// program for a Thompson-style NFA, which is simulated breadth-first
+// (a "Pike VM") with one set of capture registers per thread. Threads are
+// kept in priority order, so the results are the same as Irregexp's, but
+// the time spent per subject character is bounded by the program length.
+class RegExpNfa : public AllStatic {
+ public:
+  // Whether the parsed pattern can be matched by the NFA. Patterns that nest
+  // too deeply for the compiler's recursion are not.
+  static bool CanBeHandled(Isolate* isolate, Zone* zone, RegExpTree* tree,
+                           JSRegExp::Flags flags, int capture_count);
+
+  // Compiles the pattern of |regexp| to a program for the NFA and stores it,
+  // together with the capture name map, in the regexp's data. The pattern
+  // must be supported, see CanBeHandled. Returns false, with a stack
+  // overflow pending, if the stack runs out during compilation.
+  V8_WARN_UNUSED_RESULT static bool Compile(Handle<JSRegExp> regexp);
+
+  // Searches |subject| for a match starting at |index| or later (only at
+  // |index| for sticky regexps). On success, the capture registers are
+  // written to |output|, which must have room for all of them, and
+  // RE_SUCCESS is returned. Otherwise |output| is not touched. Unlike
+  // native code, at most one match is produced for global regexps.
+  static RegExpImpl::IrregexpResult Match(Isolate* isolate,
+                                          Handle<JSRegExp> regexp,
+                                          Handle<String> subject, int index,
+                                          int32_t* output, int output_size);
+
+  // Upper bound on the number of instructions of a program. Longer
+  // programs, e.g. due to large quantifier counts, are not supported.
+  static const int kMaxProgramLength = 16 * KB;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_NFA_H_
@@ -69,6 +69,7 @@ namespace internal {
  *      non-position.
  *    - At start of string (if 1, we are starting at the start of the
  *      string, otherwise 0)
+ *    - backtrack counter    (only used if there is a backtrack limit)
  *    - register 0  rbp[-n]   (Only positions must be stored in the first
  *    - register 1  rbp[-n-8]  num_saved_registers_ registers)
  *    - ...
@@ -123,6 +124,7 @@ RegExpMacroAssemblerX64::~RegExpMacroAssemblerX64() {
   exit_label_.Unuse();
   check_preempt_label_.Unuse();
   stack_overflow_label_.Unuse();
+  fallback_label_.Unuse();
 }
 
 
@@ -149,6 +151,11 @@ void RegExpMacroAssemblerX64::AdvanceRegister(int reg, int by) {
 
 void RegExpMacroAssemblerX64::Backtrack() {
   CheckPreemption();
+  if (has_backtrack_limit()) {
+    __ incp(Operand(rbp, kBacktrackCount));
+    __ cmpp(Operand(rbp, kBacktrackCount), Immediate(backtrack_limit()));
+    __ j(equal, &fallback_label_);
+  }
   // Pop Code* offset from backtrack stack, add Code* and jump to location.
   Pop(rbx);
   __ addp(rbx, code_object_pointer());
@@ -537,6 +544,56 @@ void RegExpMacroAssemblerX64::CheckBitInTable(
 }
 
 
+bool RegExpMacroAssemblerX64::SkipUntilCharacterInSet(
+    int cp_offset, Vector<const uc16> chars, bool mask_to_table_size) {
+  // Up to two characters are looked for in 16 bytes of input at a time,
+  // using only SSE2 and the registers xmm0-xmm5, which need not be preserved
+  // on any x64 calling convention.
+  static const int kMaxCharacters = 2;
+  static const int kVectorSize = 16;
+  if (chars.length() == 0 || chars.length() > kMaxCharacters) return false;
+  DCHECK_LE(0, cp_offset);
+
+  BroadcastCharacter(xmm0, chars[0]);
+  if (chars.length() > 1) BroadcastCharacter(xmm1, chars[1]);
+  if (mask_to_table_size) BroadcastCharacter(xmm2, kTableMask);
+
+  Label loop, found, done;
+  __ bind(&loop);
+  // Stop when the vector would extend beyond the end of the input and leave
+  // the remaining characters to the caller.
+  __ leap(rax, Operand(rdi, cp_offset * char_size() + kVectorSize));
+  __ cmpp(rax, Immediate(0));
+  __ j(greater, &done);
+  __ movdqu(xmm3, Operand(rsi, rdi, times_1, cp_offset * char_size()));
+  if (mask_to_table_size) __ pand(xmm3, xmm2);
+  if (chars.length() > 1) __ movaps(xmm4, xmm3);
+  if (mode_ == LATIN1) {
+    __ pcmpeqb(xmm3, xmm0);
+    if (chars.length() > 1) __ pcmpeqb(xmm4, xmm1);
+  } else {
+    DCHECK(mode_ == UC16);
+    __ pcmpeqw(xmm3, xmm0);
+    if (chars.length() > 1) __ pcmpeqw(xmm4, xmm1);
+  }
+  if (chars.length() > 1) __ por(xmm3, xmm4);
+  __ pmovmskb(rax, xmm3);
+  __ testl(rax, rax);
+  __ j(not_zero, &found);
+  __ addp(rdi, Immediate(kVectorSize));
+  __ jmp(&loop);
+
+  // The lowest set bit is the byte offset of the first matching character;
+  // for two-byte strings both bytes of a matching character are set, so the
+  // offset is always character aligned.
+  __ bind(&found);
+  __ bsfl(rax, rax);
+  __ addp(rdi, rax);
+  __ bind(&done);
+  return true;
+}
+
+
 bool RegExpMacroAssemblerX64::CheckSpecialCharacterClass(uc16 type,
                                                          Label* on_no_match) {
   // Range checks (c in min..max) are generally implemented by an unsigned
@@ -715,6 +772,7 @@ Handle<HeapObject> RegExpMacroAssemblerX64::GetCode(Handle<String> source) {
 
   __ Push(Immediate(0));  // Number of successful matches in a global regexp.
   __ Push(Immediate(0));  // Make room for "string start - 1" constant.
+  __ Push(Immediate(0));  // The backtrack counter.
 
   // Check if we have space on the stack for registers.
   Label stack_limit_hit;
@@ -794,6 +852,12 @@ Handle<HeapObject> RegExpMacroAssemblerX64::GetCode(Handle<String> source) {
   LoadCurrentCharacterUnchecked(-1, 1);
   __ bind(&start_regexp);
 
+  // Every match attempt of a global regexp starts with a fresh backtrack
+  // budget.
+  if (has_backtrack_limit()) {
+    __ movp(Operand(rbp, kBacktrackCount), Immediate(0));
+  }
+
   // Initialize on-stack registers.
   if (num_saved_registers_ > 0) {
     // Fill saved registers with initial value = start offset - 1
@@ -994,6 +1058,13 @@ Handle<HeapObject> RegExpMacroAssemblerX64::GetCode(Handle<String> source) {
     SafeReturn();
   }
 
+  if (fallback_label_.is_linked()) {
+    // The backtrack limit was exceeded.
+    __ bind(&fallback_label_);
+    __ Set(rax, FALLBACK_TO_NFA);
+    __ jmp(&return_rax);
+  }
+
   if (exit_with_exception.is_linked()) {
     // If any of the code above needed to exit with an exception.
     __ bind(&exit_with_exception);
@@ -1370,6 +1441,18 @@ void RegExpMacroAssemblerX64::CheckStackLimit() {
 }
 
 
+void RegExpMacroAssemblerX64::BroadcastCharacter(XMMRegister dst, uc16 c) {
+  if (mode_ == LATIN1) {
+    DCHECK_LE(c, String::kMaxOneByteCharCode);
+    __ movl(rax, Immediate(static_cast<int32_t>(c * 0x01010101u)));
+  } else {
+    __ movl(rax, Immediate(static_cast<int32_t>(c * 0x00010001u)));
+  }
+  __ movd(dst, rax);
+  __ pshufd(dst, dst, 0);
+}
+
+
 void RegExpMacroAssemblerX64::LoadCurrentCharacterUnchecked(int cp_offset,
                                                             int characters) {
   if (mode_ == LATIN1) {
@@ -55,6 +55,8 @@ class RegExpMacroAssemblerX64: public NativeRegExpMacroAssembler {
                                         uc16 to,
                                         Label* on_not_in_range);
   virtual void CheckBitInTable(Handle<ByteArray> table, Label* on_bit_set);
+  virtual bool SkipUntilCharacterInSet(int cp_offset, Vector<const uc16> chars,
+                                       bool mask_to_table_size);
 
   // Checks whether the given offset from the current position is before
   // the end of the string.
@@ -174,9 +176,11 @@ class RegExpMacroAssemblerX64: public NativeRegExpMacroAssembler {
   // When adding local variables remember to push space for them in
   // the frame in GetCode.
   static const int kStringStartMinusOne = kSuccessfulCaptures - kPointerSize;
+  // Number of backtracks performed so far, if there is a backtrack limit.
+  static const int kBacktrackCount = kStringStartMinusOne - kPointerSize;
 
   // First register address. Following registers are below it on the stack.
-  static const int kRegisterZero = kStringStartMinusOne - kPointerSize;
+  static const int kRegisterZero = kBacktrackCount - kPointerSize;
 
   // Initial size of code buffer.
   static const size_t kRegExpCodeSize = 1024;
@@ -210,6 +214,9 @@ class RegExpMacroAssemblerX64: public NativeRegExpMacroAssembler {
   // Byte size of chars in the string to match (decided by the Mode argument)
   inline int char_size() { return static_cast<int>(mode_); }
 
+  // Sets every character lane of |dst| to |c|. Clobbers rax.
+  void BroadcastCharacter(XMMRegister dst, uc16 c);
+
   // Equivalent to a conditional branch to the label, unless the label
   // is nullptr, in which case it is a conditional Backtrack.
   void BranchOrBacktrack(Condition condition, Label* to);
@@ -274,6 +281,7 @@ class RegExpMacroAssemblerX64: public NativeRegExpMacroAssembler {
   Label exit_label_;
   Label check_preempt_label_;
   Label stack_overflow_label_;
+  Label fallback_label_;
 };
 
 #endif  // V8_INTERPRETED_REGEXP
@@ -263,6 +263,141 @@ RUNTIME_FUNCTION(Runtime_RemoveArrayHoles) {
 }
 
 
+namespace {
+
+// Compares the code units of two flat strings, like String::Compare.
+bool FlatContentLessThan(const String::FlatContent& x,
+                         const String::FlatContent& y) {
+  int x_length = x.IsOneByte() ? x.ToOneByteVector().length()
+                               : x.ToUC16Vector().length();
+  int y_length = y.IsOneByte() ? y.ToOneByteVector().length()
+                               : y.ToUC16Vector().length();
+  size_t prefix_length = std::min(x_length, y_length);
+  int r;
+  if (x.IsOneByte()) {
+    const uint8_t* x_chars = x.ToOneByteVector().start();
+    r = y.IsOneByte()
+            ? CompareChars(x_chars, y.ToOneByteVector().start(), prefix_length)
+            : CompareChars(x_chars, y.ToUC16Vector().start(), prefix_length);
+  } else {
+    const uc16* x_chars = x.ToUC16Vector().start();
+    r = y.IsOneByte()
+            ? CompareChars(x_chars, y.ToOneByteVector().start(), prefix_length)
+            : CompareChars(x_chars, y.ToUC16Vector().start(), prefix_length);
+  }
+  return r < 0 || (r == 0 && x_length < y_length);
+}
+
+void SortPackedSmiElements(FixedArray* elements, uint32_t length) {
+  Object** start = elements->data_start();
+  std::stable_sort(start, start + length, [](Object* x, Object* y) {
+    return Smi::LexicographicCompare(Smi::cast(x), Smi::cast(y)) < 0;
+  });
+}
+
+void SortPackedDoubleElements(FixedDoubleArray* elements, uint32_t length) {
+  // Compute the string representation of every element once up front.
+  std::vector<std::pair<std::string, double>> entries;
+  entries.reserve(length);
+  char buffer[kDoubleToCStringMinBufferSize];
+  Vector<char> buffer_vector(buffer, arraysize(buffer));
+  for (uint32_t i = 0; i < length; ++i) {
+    double value = elements->get_scalar(i);
+    entries.emplace_back(DoubleToCString(value, buffer_vector), value);
+  }
+  std::stable_sort(entries.begin(), entries.end(),
+                   [](const std::pair<std::string, double>& x,
+                      const std::pair<std::string, double>& y) {
+                     return x.first < y.first;
+                   });
+  for (uint32_t i = 0; i < length; ++i) {
+    elements->set(i, entries[i].second);
+  }
+}
+
+// Returns false if not all elements are strings.
+bool SortPackedStringElements(Isolate* isolate, Handle<FixedArray> elements,
+                              uint32_t length) {
+  for (uint32_t i = 0; i < length; ++i) {
+    if (!elements->get(i)->IsString()) return false;
+  }
+  // Flatten all elements up front, so that the comparisons below don't need
+  // to allocate.
+  for (uint32_t i = 0; i < length; ++i) {
+    Handle<String> string(String::cast(elements->get(i)), isolate);
+    Handle<String> flat = String::Flatten(string);
+    if (!flat.is_identical_to(string)) elements->set(i, *flat);
+  }
+
+  DisallowHeapAllocation no_gc;
+  std::vector<std::pair<String::FlatContent, Object*>> entries;
+  entries.reserve(length);
+  for (uint32_t i = 0; i < length; ++i) {
+    String* string = String::cast(elements->get(i));
+    entries.emplace_back(string->GetFlatContent(), string);
+  }
+  std::stable_sort(
+      entries.begin(), entries.end(),
+      [](const std::pair<String::FlatContent, Object*>& x,
+         const std::pair<String::FlatContent, Object*>& y) {
+        return FlatContentLessThan(x.first, y.first);
+      });
+  WriteBarrierMode mode = elements->GetWriteBarrierMode(no_gc);
+  for (uint32_t i = 0; i < length; ++i) {
+    elements->set(i, entries[i].second, mode);
+  }
+  return true;
+}
+
+}  // namespace
+
+// Sorts a packed JSArray of Smis, doubles or strings with the default
+// comparator, i.e. by the elements' string representations. The sort is
+// stable. Returns false if the array doesn't qualify, in which case the
+// caller has to fall back to the generic sort.
+RUNTIME_FUNCTION(Runtime_ArraySortFast) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(2, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSReceiver, object, 0);
+  CONVERT_NUMBER_CHECKED(uint32_t, length, Uint32, args[1]);
+  if (!object->IsJSArray()) return isolate->heap()->false_value();
+  Handle<JSArray> array = Handle<JSArray>::cast(object);
+  ElementsKind kind = array->GetElementsKind();
+  if (!IsFastPackedElementsKind(kind)) return isolate->heap()->false_value();
+  uint32_t array_length;
+  if (!array->length()->ToArrayLength(&array_length) ||
+      array_length != length) {
+    return isolate->heap()->false_value();
+  }
+  if (length < 2) return isolate->heap()->true_value();
+
+  JSObject::EnsureWritableFastElements(array);
+  switch (kind) {
+    case PACKED_SMI_ELEMENTS: {
+      DisallowHeapAllocation no_gc;
+      SortPackedSmiElements(FixedArray::cast(array->elements()), length);
+      break;
+    }
+    case PACKED_DOUBLE_ELEMENTS: {
+      DisallowHeapAllocation no_gc;
+      SortPackedDoubleElements(FixedDoubleArray::cast(array->elements()),
+                               length);
+      break;
+    }
+    case PACKED_ELEMENTS: {
+      Handle<FixedArray> elements(FixedArray::cast(array->elements()), isolate);
+      if (!SortPackedStringElements(isolate, elements, length)) {
+        return isolate->heap()->false_value();
+      }
+      break;
+    }
+    default:
+      UNREACHABLE();
+  }
+  return isolate->heap()->true_value();
+}
+
+
 // Move contents of argument 0 (an array) to argument 1 (an array)
 RUNTIME_FUNCTION(Runtime_MoveArrayContents) {
   HandleScope scope(isolate);
@@ -10,6 +10,7 @@
 #include "src/compiler.h"
 #include "src/deoptimizer.h"
 #include "src/frames-inl.h"
+#include "src/interpreter/bytecode-array-accessor.h"
 #include "src/isolate-inl.h"
 #include "src/messages.h"
 #include "src/v8threads.h"
@@ -141,6 +142,105 @@ RUNTIME_FUNCTION(Runtime_InstantiateAsmJs) {
   return Smi::kZero;
 }
 
+namespace {
+
+// Returns the operand index of the feedback slot of {bytecode} if TurboFan
+// speculates on that feedback and FeedbackNexus::Generalize can widen it, or
+// -1 otherwise.
+int GeneralizableFeedbackSlotOperand(interpreter::Bytecode bytecode) {
+  using interpreter::Bytecode;
+  using interpreter::Bytecodes;
+  switch (bytecode) {
+    case Bytecode::kInc:
+    case Bytecode::kDec:
+    case Bytecode::kNegate:
+    case Bytecode::kBitwiseNot:
+      return 0;
+    case Bytecode::kLdaKeyedProperty:
+    case Bytecode::kAdd:
+    case Bytecode::kSub:
+    case Bytecode::kMul:
+    case Bytecode::kDiv:
+    case Bytecode::kMod:
+    case Bytecode::kExp:
+    case Bytecode::kBitwiseOr:
+    case Bytecode::kBitwiseXor:
+    case Bytecode::kBitwiseAnd:
+    case Bytecode::kShiftLeft:
+    case Bytecode::kShiftRight:
+    case Bytecode::kShiftRightLogical:
+    case Bytecode::kAddSmi:
+    case Bytecode::kSubSmi:
+    case Bytecode::kMulSmi:
+    case Bytecode::kDivSmi:
+    case Bytecode::kModSmi:
+    case Bytecode::kExpSmi:
+    case Bytecode::kBitwiseOrSmi:
+    case Bytecode::kBitwiseXorSmi:
+    case Bytecode::kBitwiseAndSmi:
+    case Bytecode::kShiftLeftSmi:
+    case Bytecode::kShiftRightSmi:
+    case Bytecode::kShiftRightLogicalSmi:
+    case Bytecode::kTestEqual:
+    case Bytecode::kTestEqualStrict:
+    case Bytecode::kTestLessThan:
+    case Bytecode::kTestGreaterThan:
+    case Bytecode::kTestLessThanOrEqual:
+    case Bytecode::kTestGreaterThanOrEqual:
+    case Bytecode::kForInPrepare:
+      return 1;
+    case Bytecode::kLdaNamedProperty:
+    case Bytecode::kStaNamedProperty:
+    case Bytecode::kStaNamedOwnProperty:
+    case Bytecode::kStaKeyedProperty:
+    case Bytecode::kStaInArrayLiteral:
+      return 2;
+    case Bytecode::kForInNext:
+      return 3;
+    default:
+      if (Bytecodes::IsCallOrConstruct(bytecode) &&
+          bytecode != Bytecode::kCallJSRuntime) {
+        int operand_index = Bytecodes::NumberOfOperands(bytecode) - 1;
+        DCHECK_EQ(interpreter::OperandType::kIdx,
+                  Bytecodes::GetOperandType(bytecode, operand_index));
+        return operand_index;
+      }
+      return -1;
+  }
+}
+
+// Records an eager deopt at the bytecode {frame} resumes at. Optimized code
+// that keeps deoptimizing at the same bytecode is stuck in a deopt loop, so
+// the feedback there is generalized for the next optimization to compile a
+// generic operation instead of the failing speculation. The site is keyed on
+// the function of the innermost frame, so deopts in inlined functions are
+// recorded against the inlinee rather than the outermost function.
+void RecordDeoptSite(Isolate* isolate, InterpretedFrame* frame) {
+  JSFunction* function = frame->function();
+  if (!function->has_feedback_vector()) return;
+  FeedbackVector* vector = function->feedback_vector();
+  int offset = frame->GetBytecodeOffset();
+  int count = vector->RecordDeoptSite(offset);
+  if (FLAG_max_same_site_deopts <= 0 || count < FLAG_max_same_site_deopts) {
+    return;
+  }
+  vector->set_same_site_deopt_count(0);
+
+  interpreter::BytecodeArrayAccessor accessor(
+      handle(frame->GetBytecodeArray(), isolate), offset);
+  int operand_index =
+      GeneralizableFeedbackSlotOperand(accessor.current_bytecode());
+  if (operand_index < 0) return;
+  FeedbackSlot slot = accessor.GetSlotOperand(operand_index);
+  if (slot.IsInvalid() || slot.ToInt() >= vector->length()) return;
+  FeedbackNexus nexus(vector, slot);
+  if (nexus.Generalize()) {
+    isolate->counters()->deopt_loops_detected()->Increment();
+  }
+}
+
+}  // namespace
+
 RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   HandleScope scope(isolate);
   DCHECK_EQ(0, args.length());
@@ -154,6 +254,7 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   TRACE_EVENT0("v8", "V8.DeoptimizeCode");
   Handle<JSFunction> function = deoptimizer->function();
   Deoptimizer::BailoutType type = deoptimizer->bailout_type();
+  bool record_deopt_site = deoptimizer->record_deopt_site();
 
   // TODO(turbofan): We currently need the native context to materialize
   // the arguments object, but only to get to its map.
@@ -171,6 +272,9 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   // Invalidate the underlying optimized code on non-lazy deopts.
   if (type != Deoptimizer::LAZY) {
     Deoptimizer::DeoptimizeFunction(*function);
+    if (record_deopt_site && top_frame->is_interpreted()) {
+      RecordDeoptSite(isolate, InterpretedFrame::cast(top_frame));
+    }
   }
 
   return isolate->heap()->undefined_value();
@@ -100,6 +100,116 @@ bool CompareNum(T x, T y) {
   return false;
 }
 
+// Arrays shorter than this are sorted with std::sort, which beats the
+// radix sort's fixed histogram and copying costs on small inputs.
+constexpr size_t kMinRadixSortLength = 1024;
+
+// Maps element values to unsigned keys whose natural order matches
+// CompareNum, so that they can be sorted digit by digit.
+template <typename T>
+struct RadixTraits {
+  typedef typename std::make_unsigned<T>::type Key;
+  static Key ToKey(T value) {
+    // Flipping the sign bit orders negative values before positive ones.
+    const Key kSignBit = std::is_signed<T>::value
+                             ? static_cast<Key>(Key{1} << (sizeof(T) * 8 - 1))
+                             : Key{0};
+    return static_cast<Key>(static_cast<Key>(value) ^ kSignBit);
+  }
+};
+
+template <typename T, typename K>
+struct FloatRadixTraits {
+  typedef K Key;
+  static Key ToKey(T value) {
+    // NaNs, whatever their sign, go after everything else.
+    if (std::isnan(value)) return std::numeric_limits<Key>::max();
+    // Negative values have their bits inverted so that larger magnitudes
+    // sort first; this also puts -0 before +0.
+    const Key kSignBit = Key{1} << (sizeof(T) * 8 - 1);
+    Key bits = bit_cast<Key>(value);
+    return (bits & kSignBit) ? ~bits : (bits | kSignBit);
+  }
+};
+
+template <>
+struct RadixTraits<float> : public FloatRadixTraits<float, uint32_t> {};
+template <>
+struct RadixTraits<double> : public FloatRadixTraits<double, uint64_t> {};
+
+constexpr int kRadixSortRadix = 256;
+
+// Size of the scratch memory RadixSort needs for {length} elements: one
+// histogram per key byte, followed by room for a copy of the elements.
+template <typename T>
+size_t RadixSortScratchSize(size_t length) {
+  typedef typename RadixTraits<T>::Key Key;
+  return sizeof(Key) * kRadixSortRadix * sizeof(size_t) + length * sizeof(T);
+}
+
+// Stable LSD radix sort over the bytes of the element keys. {scratch} must
+// provide RadixSortScratchSize<T>(length) bytes.
+template <typename T>
+void RadixSort(T* data, size_t length, void* scratch) {
+  typedef RadixTraits<T> Traits;
+  typedef typename Traits::Key Key;
+  static const int kDigits = sizeof(Key);
+  static const int kRadix = kRadixSortRadix;
+
+  size_t(*counts)[kRadix] = reinterpret_cast<size_t(*)[kRadix]>(scratch);
+  std::fill(counts[0], counts[0] + kDigits * kRadix, 0);
+
+  // Build the histograms of all digits in a single pass.
+  for (size_t i = 0; i < length; ++i) {
+    Key key = Traits::ToKey(data[i]);
+    for (int d = 0; d < kDigits; ++d) {
+      counts[d][(key >> (d * 8)) & (kRadix - 1)]++;
+    }
+  }
+
+  T* from = data;
+  T* to = reinterpret_cast<T*>(counts + kDigits);
+  for (int d = 0; d < kDigits; ++d) {
+    size_t* count = counts[d];
+    int shift = d * 8;
+    // Skip digits that are the same for all elements.
+    if (count[(Traits::ToKey(from[0]) >> shift) & (kRadix - 1)] == length) {
+      continue;
+    }
+    size_t offset = 0;
+    for (int digit = 0; digit < kRadix; ++digit) {
+      size_t digit_count = count[digit];
+      count[digit] = offset;
+      offset += digit_count;
+    }
+    for (size_t i = 0; i < length; ++i) {
+      T value = from[i];
+      to[count[(Traits::ToKey(value) >> shift) & (kRadix - 1)]++] = value;
+    }
+    std::swap(from, to);
+  }
+  if (from != data) std::copy(from, from + length, data);
+}
+
+template <typename T>
+void SortElements(T* data, size_t length, bool use_radix_sort) {
+  if (use_radix_sort) {
+    // The scratch memory is as large as the array itself. If it cannot be
+    // allocated, sort in place instead of failing.
+    void* scratch = AllocWithRetry(RadixSortScratchSize<T>(length));
+    if (scratch != nullptr) {
+      RadixSort(data, length, scratch);
+      free(scratch);
+      return;
+    }
+  }
+  if (std::is_floating_point<T>::value) {
+    std::sort(data, data + length, CompareNum<T>);
+  } else {
+    std::sort(data, data + length);
+  }
+}
+
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
@@ -120,19 +230,20 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
   size_t length = array->length_value();
   if (length <= 1) return *array;
 
+  // Radix sort reads every element several times, which is only safe if no
+  // other thread can modify the elements concurrently.
+  bool use_radix_sort =
+      length >= kMinRadixSortLength &&
+      !JSArrayBuffer::cast(array->buffer())->is_shared();
+
   Handle<FixedTypedArrayBase> elements(
       FixedTypedArrayBase::cast(array->elements()));
   switch (array->type()) {
-#define TYPED_ARRAY_SORT(Type, type, TYPE, ctype, size)     \
-  case kExternal##Type##Array: {                            \
-    ctype* data = static_cast<ctype*>(elements->DataPtr()); \
-    if (kExternal##Type##Array == kExternalFloat64Array ||  \
-        kExternal##Type##Array == kExternalFloat32Array)    \
-      std::sort(data, data + length, CompareNum<ctype>);    \
-    else                                                    \
-      std::sort(data, data + length);                       \
-    break;                                                  \
-  }
+#define TYPED_ARRAY_SORT(Type, type, TYPE, ctype, size)            \
+  case kExternal##Type##Array:                                     \
+    SortElements(static_cast<ctype*>(elements->DataPtr()), length, \
+                 use_radix_sort);                                  \
+    break;
 
     TYPED_ARRAYS(TYPED_ARRAY_SORT)
 #undef TYPED_ARRAY_SORT
@@ -40,6 +40,7 @@ namespace internal {
   F(ArrayIncludes_Slow, 3, 1)       \
   F(ArrayIndexOf, 3, 1)             \
   F(ArrayIsArray, 1, 1)             \
+  F(ArraySortFast, 2, 1)            \
   F(ArraySpeciesConstructor, 1, 1)  \
   F(EstimateNumberOfElements, 1, 1) \
   F(GetArrayKeys, 2, 1)             \
@@ -349,6 +349,11 @@ class IncrementalStringBuilder {
     }
 
     INLINE(void Append(DestChar c)) { *(cursor_++) = c; }
+    template <typename SrcChar>
+    INLINE(void AppendChars(const SrcChar* chars, int length)) {
+      CopyChars(cursor_, chars, length);
+      cursor_ += length;
+    }
     INLINE(void AppendCString(const char* s)) {
       const uint8_t* u = reinterpret_cast<const uint8_t*>(s);
       while (*u != '\0') Append(*(u++));
@@ -5,6 +5,7 @@
 #ifndef V8_STRING_HASHER_INL_H_
 #define V8_STRING_HASHER_INL_H_
 
+#include "src/base/bits.h"
 #include "src/char-predicates-inl.h"
 #include "src/objects.h"
 #include "src/string-hasher.h"
@@ -12,13 +13,29 @@
 namespace v8 {
 namespace internal {
 
+uint64_t StringHasher::HashRound(uint64_t lane, uint64_t input) {
+  lane += input * kHashPrime2;
+  lane = base::bits::RotateLeft64(lane, 31);
+  return lane * kHashPrime1;
+}
+
+template <typename Char>
+uint64_t StringHasher::PackCharacters(const Char* chars) {
+  return static_cast<uint64_t>(static_cast<uint16_t>(chars[0])) |
+         static_cast<uint64_t>(static_cast<uint16_t>(chars[1])) << 16 |
+         static_cast<uint64_t>(static_cast<uint16_t>(chars[2])) << 32 |
+         static_cast<uint64_t>(static_cast<uint16_t>(chars[3])) << 48;
+}
+
 StringHasher::StringHasher(int length, uint32_t seed)
     : length_(length),
-      raw_running_hash_(seed),
+      pending_count_(0),
       array_index_(0),
       is_array_index_(0 < length_ && length_ <= String::kMaxArrayIndexSize),
       is_first_char_(true) {
-  DCHECK(FLAG_randomize_hashes || raw_running_hash_ == 0);
+  DCHECK(FLAG_randomize_hashes || seed == 0);
+  lanes_[0] = seed + kHashPrime1 + kHashPrime2;
+  lanes_[1] = seed + kHashPrime2;
 }
 
 bool StringHasher::has_trivial_hash() {
@@ -42,32 +59,42 @@ uint32_t StringHasher::GetHashCore(uint32_t running_hash) {
   return running_hash;
 }
 
-uint32_t StringHasher::ComputeRunningHash(uint32_t running_hash,
-                                          const uc16* chars, int length) {
-  DCHECK_NOT_NULL(chars);
-  DCHECK_GE(length, 0);
-  for (int i = 0; i < length; ++i) {
-    running_hash = AddCharacterCore(running_hash, *chars++);
-  }
-  return running_hash;
+template <typename Char>
+void StringHasher::AddBlock(const Char* chars) {
+  STATIC_ASSERT(kBlockSize == 8);
+  lanes_[0] = HashRound(lanes_[0], PackCharacters(chars));
+  lanes_[1] = HashRound(lanes_[1], PackCharacters(chars + 4));
 }
 
-uint32_t StringHasher::ComputeRunningHashOneByte(uint32_t running_hash,
-                                                 const char* chars,
-                                                 int length) {
-  DCHECK_NOT_NULL(chars);
-  DCHECK_GE(length, 0);
-  for (int i = 0; i < length; ++i) {
-    uint16_t c = static_cast<uint16_t>(*chars++);
-    running_hash = AddCharacterCore(running_hash, c);
+void StringHasher::AddCharacter(uint16_t c) {
+  pending_[pending_count_++] = c;
+  if (pending_count_ == kBlockSize) {
+    AddBlock(pending_);
+    pending_count_ = 0;
   }
-  return running_hash;
 }
 
-void StringHasher::AddCharacter(uint16_t c) {
-  // Use the Jenkins one-at-a-time hash function to update the hash
-  // for the given character.
-  raw_running_hash_ = AddCharacterCore(raw_running_hash_, c);
+uint32_t StringHasher::GetHash() {
+  uint64_t hash = base::bits::RotateLeft64(lanes_[0], 1) +
+                  base::bits::RotateLeft64(lanes_[1], 7) +
+                  static_cast<uint64_t>(length_);
+  // Mix in the remaining characters, padded with zeros. The length above
+  // tells apart strings that differ in trailing zeros.
+  DCHECK_LT(pending_count_, kBlockSize);
+  for (int i = pending_count_; i < kBlockSize; i++) pending_[i] = 0;
+  for (int i = 0; i < pending_count_; i += 4) {
+    hash ^= HashRound(0, PackCharacters(pending_ + i));
+    hash = base::bits::RotateLeft64(hash, 27) * kHashPrime1 + kHashPrime4;
+  }
+  // Avalanche.
+  hash ^= hash >> 33;
+  hash *= kHashPrime2;
+  hash ^= hash >> 29;
+  hash *= kHashPrime3;
+  hash ^= hash >> 32;
+  uint32_t result = static_cast<uint32_t>(hash);
+  if ((result & String::kHashBitMask) == 0) return kZeroHash;
+  return result;
 }
 
 bool StringHasher::UpdateIndex(uint16_t c) {
@@ -105,10 +132,13 @@ inline void StringHasher::AddCharacters(const Char* chars, int length) {
       }
     }
   }
-  for (; i < length; i++) {
+  // Complete the pending block, then mix whole blocks straight from |chars|.
+  while (pending_count_ != 0 && i < length) AddCharacter(chars[i++]);
+  for (; i + kBlockSize <= length; i += kBlockSize) {
     DCHECK(!is_array_index_);
-    AddCharacter(chars[i]);
+    AddBlock(chars + i);
   }
+  for (; i < length; i++) AddCharacter(chars[i]);
 }
 
 template <typename schar>
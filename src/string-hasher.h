@@ -16,6 +16,12 @@ class String;
 template <typename T>
 class Vector;
 
+// Computes the hash field of strings. The hash is a function of the UTF-16
+// code units only, so one-byte and two-byte representations of a string hash
+// the same, and it can be computed incrementally for strings made of several
+// pieces. Characters are mixed into two independent 64-bit lanes in blocks of
+// kBlockSize, using the round function of xxHash64; the characters left over
+// at the end are mixed in when the hash is finalized.
 class V8_EXPORT_PRIVATE StringHasher {
  public:
   explicit inline StringHasher(int length, uint32_t seed);
@@ -38,14 +44,10 @@ class V8_EXPORT_PRIVATE StringHasher {
   // use 27 instead.
   static const int kZeroHash = 27;
 
-  // Reusable parts of the hashing algorithm.
+  // The Jenkins one-at-a-time hash, which the heap uses for its allocation
+  // hash.
   INLINE(static uint32_t AddCharacterCore(uint32_t running_hash, uint16_t c));
   INLINE(static uint32_t GetHashCore(uint32_t running_hash));
-  INLINE(static uint32_t ComputeRunningHash(uint32_t running_hash,
-                                            const uc16* chars, int length));
-  INLINE(static uint32_t ComputeRunningHashOneByte(uint32_t running_hash,
-                                                   const char* chars,
-                                                   int length));
 
  protected:
   // Returns the value to store in the hash field of a string with
@@ -59,13 +61,37 @@ class V8_EXPORT_PRIVATE StringHasher {
   inline void AddCharacters(const Char* chars, int len);
 
  private:
+  // Number of characters mixed into the lanes at a time, four per lane.
+  static const int kBlockSize = 8;
+
+  // The primes of xxHash64.
+  static const uint64_t kHashPrime1 = V8_2PART_UINT64_C(0x9E3779B1, 85EBCA87);
+  static const uint64_t kHashPrime2 = V8_2PART_UINT64_C(0xC2B2AE3D, 27D4EB4F);
+  static const uint64_t kHashPrime3 = V8_2PART_UINT64_C(0x165667B1, 9E3779F9);
+  static const uint64_t kHashPrime4 = V8_2PART_UINT64_C(0x85EBCA77, C2B2AE63);
+
+  // The round function of xxHash64.
+  INLINE(static uint64_t HashRound(uint64_t lane, uint64_t input));
+  // Packs four characters into a word, independently of their width and of
+  // the byte order.
+  template <typename Char>
+  static inline uint64_t PackCharacters(const Char* chars);
+
   // Add a character to the hash.
   inline void AddCharacter(uint16_t c);
+  // Mixes kBlockSize characters into the lanes.
+  template <typename Char>
+  inline void AddBlock(const Char* chars);
   // Update index. Returns true if string is still an index.
   inline bool UpdateIndex(uint16_t c);
+  // Returns the hash of all characters added so far, which must be all
+  // characters of the string.
+  inline uint32_t GetHash();
 
   int length_;
-  uint32_t raw_running_hash_;
+  uint64_t lanes_[2];
+  uint16_t pending_[kBlockSize];
+  int pending_count_;
   uint32_t array_index_;
   bool is_array_index_;
   bool is_first_char_;
@@ -6,6 +6,7 @@
 #define V8_STRING_SEARCH_H_
 
 #include "src/isolate.h"
+#include "src/utils.h"
 #include "src/vector.h"
 
 namespace v8 {
@@ -113,6 +114,10 @@ class StringSearch : private StringSearchBase {
                           Vector<const SubjectChar> subject,
                           int start_index);
 
+  static int TwoCharacterFilterSearch(
+      StringSearch<PatternChar, SubjectChar>* search,
+      Vector<const SubjectChar> subject, int start_index);
+
   static int InitialSearch(StringSearch<PatternChar, SubjectChar>* search,
                            Vector<const SubjectChar> subject,
                            int start_index);
@@ -270,7 +275,9 @@ inline bool CharCompare(const PatternChar* pattern,
 }
 
 
-// Simple linear search for short patterns. Never bails out.
+// Simple linear search for short patterns, which bails out to the two
+// character filter if the first character of the pattern is too common in the
+// subject for memchr to be effective.
 template <typename PatternChar, typename SubjectChar>
 int StringSearch<PatternChar, SubjectChar>::LinearSearch(
     StringSearch<PatternChar, SubjectChar>* search,
@@ -279,9 +286,15 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   Vector<const PatternChar> pattern = search->pattern_;
   DCHECK_GT(pattern.length(), 1);
   int pattern_length = pattern.length();
+  // Badness is a count of how much work we have done, as in InitialSearch.
+  int badness = -10 - (pattern_length << 2);
   int i = index;
   int n = subject.length() - pattern_length;
   while (i <= n) {
+    if (++badness > 0) {
+      search->strategy_ = &TwoCharacterFilterSearch;
+      return TwoCharacterFilterSearch(search, subject, i);
+    }
     i = FindFirstCharacter(pattern, subject, i);
     if (i == -1) return -1;
     DCHECK_LE(i, n);
@@ -293,6 +306,76 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
                     pattern_length - 1)) {
       return i - 1;
     }
+    badness += pattern_length;
+  }
+  return -1;
+}
+
+//---------------------------------------------------------------------
+// Two character filter search
+//---------------------------------------------------------------------
+
+// Returns a word with each of its character sized lanes set to |c|.
+template <typename Char>
+inline uintptr_t BroadcastCharacter(Char c) {
+  static const uintptr_t kLaneOnes =
+      ~static_cast<uintptr_t>(0) / static_cast<Char>(~static_cast<Char>(0));
+  return kLaneOnes * c;
+}
+
+// Returns non-zero iff any character sized lane of |word| is zero.
+template <typename Char>
+inline uintptr_t HasZeroCharacter(uintptr_t word) {
+  static const uintptr_t kLaneOnes = BroadcastCharacter<Char>(1);
+  static const uintptr_t kLaneHighBits = kLaneOnes
+                                         << (kBitsPerByte * sizeof(Char) - 1);
+  return (word - kLaneOnes) & ~word & kLaneHighBits;
+}
+
+// Compares both the first and the last character of the pattern against the
+// subject, for a machine word worth of start positions at a time. Positions
+// that pass the filter are verified character by character. Unlike memchr on
+// the first character, this stays fast when that character is frequent.
+template <typename PatternChar, typename SubjectChar>
+int StringSearch<PatternChar, SubjectChar>::TwoCharacterFilterSearch(
+    StringSearch<PatternChar, SubjectChar>* search,
+    Vector<const SubjectChar> subject, int index) {
+  static const int kCharsPerWord = sizeof(uintptr_t) / sizeof(SubjectChar);
+  Vector<const PatternChar> pattern = search->pattern_;
+  int pattern_length = pattern.length();
+  DCHECK_GT(pattern_length, 1);
+  // Patterns with characters that cannot occur in the subject use FailSearch.
+  const SubjectChar first = static_cast<SubjectChar>(pattern[0]);
+  const SubjectChar last =
+      static_cast<SubjectChar>(pattern[pattern_length - 1]);
+  const SubjectChar* chars = subject.start();
+  int n = subject.length() - pattern_length;
+
+  auto matches_at = [=](int i) {
+    return chars[i] == first && chars[i + pattern_length - 1] == last &&
+           (pattern_length == 2 || CharCompare(pattern.start() + 1,
+                                               chars + i + 1,
+                                               pattern_length - 2));
+  };
+
+  const uintptr_t first_word = BroadcastCharacter(first);
+  const uintptr_t last_word = BroadcastCharacter(last);
+  int i = index;
+  for (; i <= n - kCharsPerWord + 1; i += kCharsPerWord) {
+    uintptr_t firsts =
+        ReadUnalignedValue<uintptr_t>(reinterpret_cast<Address>(chars + i));
+    uintptr_t lasts = ReadUnalignedValue<uintptr_t>(
+        reinterpret_cast<Address>(chars + i + pattern_length - 1));
+    if (!HasZeroCharacter<SubjectChar>((firsts ^ first_word) |
+                                       (lasts ^ last_word))) {
+      continue;
+    }
+    for (int j = i; j < i + kCharsPerWord; j++) {
+      if (matches_at(j)) return j;
+    }
+  }
+  for (; i <= n; i++) {
+    if (matches_at(i)) return i;
   }
   return -1;
 }
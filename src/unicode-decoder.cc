@@ -52,24 +52,57 @@ bool Utf8Iterator::Done() {
 
 void Utf8DecoderBase::Reset(uint16_t* buffer, size_t buffer_length,
                             const v8::internal::Vector<const char>& stream) {
+  const byte* bytes = reinterpret_cast<const byte*>(stream.start());
+  size_t stream_length = static_cast<size_t>(stream.length());
+  size_t cursor = 0;
   size_t utf16_length = 0;
+  trailing_ = false;
 
-  Utf8Iterator it = Utf8Iterator(stream);
   // Loop until stream is read, writing to buffer as long as buffer has space.
-  while (utf16_length < buffer_length && !it.Done()) {
-    *buffer++ = *it;
-    ++it;
-    utf16_length++;
+  while (utf16_length < buffer_length && cursor < stream_length) {
+    size_t ascii_length =
+        std::min(v8::internal::AsciiPrefixLength(bytes + cursor,
+                                                 stream_length - cursor),
+                 buffer_length - utf16_length);
+    if (ascii_length > 0) {
+      v8::internal::CopyChars(buffer + utf16_length, bytes + cursor,
+                              ascii_length);
+      cursor += ascii_length;
+      utf16_length += ascii_length;
+      continue;
+    }
+    size_t char_start = cursor;
+    uchar c = Utf8::ValueOf(bytes + cursor, stream_length - cursor, &cursor);
+    if (c > Utf16::kMaxNonSurrogateCharCode) {
+      buffer[utf16_length++] = Utf16::LeadSurrogate(c);
+      if (utf16_length == buffer_length) {
+        // Only the lead surrogate fits, WriteUtf16Slow starts with the trail.
+        cursor = char_start;
+        trailing_ = true;
+        break;
+      }
+      buffer[utf16_length++] = Utf16::TrailSurrogate(c);
+    } else {
+      buffer[utf16_length++] = static_cast<uint16_t>(c);
+    }
   }
-  bytes_read_ = it.Offset();
-  trailing_ = it.Trailing();
+  bytes_read_ = cursor;
   chars_written_ = utf16_length;
 
   // Now that writing to buffer is done, we just need to calculate utf16_length
-  while (!it.Done()) {
-    ++it;
+  if (trailing_) {
+    Utf8::ValueOf(bytes + cursor, stream_length - cursor, &cursor);
     utf16_length++;
   }
+  while (cursor < stream_length) {
+    size_t ascii_length = v8::internal::AsciiPrefixLength(
+        bytes + cursor, stream_length - cursor);
+    cursor += ascii_length;
+    utf16_length += ascii_length;
+    if (cursor == stream_length) break;
+    uchar c = Utf8::ValueOf(bytes + cursor, stream_length - cursor, &cursor);
+    utf16_length += c > Utf16::kMaxNonSurrogateCharCode ? 2 : 1;
+  }
   utf16_length_ = utf16_length;
 }
 
@@ -77,11 +110,36 @@ void Utf8DecoderBase::WriteUtf16Slow(
     uint16_t* data, size_t length,
     const v8::internal::Vector<const char>& stream, size_t offset,
     bool trailing) {
-  Utf8Iterator it = Utf8Iterator(stream, offset, trailing);
-  while (!it.Done()) {
-    DCHECK_GT(length--, 0);
-    *data++ = *it;
-    ++it;
+  const byte* bytes = reinterpret_cast<const byte*>(stream.start());
+  size_t stream_length = static_cast<size_t>(stream.length());
+  size_t cursor = offset;
+  if (trailing) {
+    uchar c = Utf8::ValueOf(bytes + cursor, stream_length - cursor, &cursor);
+    DCHECK_GT(c, Utf16::kMaxNonSurrogateCharCode);
+    DCHECK_GT(length, 0);
+    length--;
+    *data++ = Utf16::TrailSurrogate(c);
+  }
+  while (cursor < stream_length) {
+    size_t ascii_length = v8::internal::AsciiPrefixLength(
+        bytes + cursor, stream_length - cursor);
+    DCHECK_LE(ascii_length, length);
+    v8::internal::CopyChars(data, bytes + cursor, ascii_length);
+    data += ascii_length;
+    cursor += ascii_length;
+    length -= ascii_length;
+    if (cursor == stream_length) break;
+    uchar c = Utf8::ValueOf(bytes + cursor, stream_length - cursor, &cursor);
+    if (c > Utf16::kMaxNonSurrogateCharCode) {
+      DCHECK_GE(length, 2);
+      length -= 2;
+      *data++ = Utf16::LeadSurrogate(c);
+      *data++ = Utf16::TrailSurrogate(c);
+    } else {
+      DCHECK_GT(length, 0);
+      length--;
+      *data++ = static_cast<uint16_t>(c);
+    }
   }
 }
 
@@ -6,6 +6,9 @@
 
 #include <stdarg.h>
 #include <sys/stat.h>
+#if V8_HOST_ARCH_IA32 || V8_HOST_ARCH_X64
+#include <emmintrin.h>
+#endif
 
 #include "src/base/functional.h"
 #include "src/base/logging.h"
@@ -402,6 +405,42 @@ MemCopyUint8Function CreateMemCopyUint8Function(Isolate* isolate,
                                                 MemCopyUint8Function stub);
 #endif
 
+#if V8_HOST_ARCH_IA32 || V8_HOST_ARCH_X64
+// SSE2 is available on all supported x86 hosts, so widening and narrowing
+// are done 16 characters at a time.
+void MemCopyUint16Uint8SSE2(uint16_t* dest, const uint8_t* src,
+                            size_t chars) {
+  const __m128i zero = _mm_setzero_si128();
+  size_t i = 0;
+  for (; i + 16 <= chars; i += 16) {
+    __m128i bytes =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i),
+                     _mm_unpacklo_epi8(bytes, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i + 8),
+                     _mm_unpackhi_epi8(bytes, zero));
+  }
+  for (; i < chars; i++) dest[i] = src[i];
+}
+
+void MemCopyUint8Uint16SSE2(uint8_t* dest, const uint16_t* src,
+                            size_t chars) {
+  // Like the scalar loop, this truncates characters that are not one-byte.
+  const __m128i low_bytes = _mm_set1_epi16(0xFF);
+  size_t i = 0;
+  for (; i + 16 <= chars; i += 16) {
+    __m128i low = _mm_and_si128(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), low_bytes);
+    __m128i high = _mm_and_si128(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8)),
+        low_bytes);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i),
+                     _mm_packus_epi16(low, high));
+  }
+  for (; i < chars; i++) dest[i] = static_cast<uint8_t>(src[i]);
+}
+#endif
+
 
 static bool g_memcopy_functions_initialized = false;
 
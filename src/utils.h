@@ -754,6 +754,38 @@ inline int CompareChars(const lchar* lhs, const rchar* rhs, size_t chars) {
   }
 }
 
+// Returns the length of a prefix of |bytes| that is all ASCII. Bytes are
+// checked a word at a time, so the result may point to the first aligned word
+// containing a non-ASCII byte rather than directly to that byte. If the result
+// equals |length|, all bytes are ASCII.
+inline size_t AsciiPrefixLength(const uint8_t* bytes, size_t length) {
+  const uint8_t* start = bytes;
+  const uint8_t* limit = bytes + length;
+  const uint8_t kMaxAsciiChar = 0x7F;
+
+  if (length >= sizeof(uintptr_t)) {
+    // Check unaligned bytes.
+    while (!IsAligned(reinterpret_cast<intptr_t>(bytes), sizeof(uintptr_t))) {
+      if (*bytes > kMaxAsciiChar) return static_cast<size_t>(bytes - start);
+      ++bytes;
+    }
+    // Check aligned words.
+    const uintptr_t non_ascii_mask = kUintptrAllBitsSet / 0xFF * 0x80;
+    while (bytes + sizeof(uintptr_t) <= limit) {
+      if (*reinterpret_cast<const uintptr_t*>(bytes) & non_ascii_mask) {
+        return static_cast<size_t>(bytes - start);
+      }
+      bytes += sizeof(uintptr_t);
+    }
+  }
+  // Check remaining unaligned bytes.
+  while (bytes < limit) {
+    if (*bytes > kMaxAsciiChar) return static_cast<size_t>(bytes - start);
+    ++bytes;
+  }
+  return static_cast<size_t>(bytes - start);
+}
+
 
 // Calculate 10^exponent.
 inline int TenToThe(int exponent) {
@@ -1258,6 +1290,19 @@ INLINE(void CopyCharsUnsigned(uint16_t* dest, const uint16_t* src,
 INLINE(void CopyCharsUnsigned(uint8_t* dest, const uint8_t* src, size_t chars));
 INLINE(void CopyCharsUnsigned(uint16_t* dest, const uint16_t* src,
                               size_t chars));
+#elif defined(V8_HOST_ARCH_IA32) || defined(V8_HOST_ARCH_X64)
+INLINE(void CopyCharsUnsigned(uint16_t* dest, const uint8_t* src,
+                              size_t chars));
+INLINE(void CopyCharsUnsigned(uint8_t* dest, const uint16_t* src,
+                              size_t chars));
+// SSE2 widening and narrowing copies, defined in utils.cc. For fewer
+// characters than kMinSSE2ConvertCopy, the inlined C code is faster.
+const size_t kMinSSE2ConvertCopy = 16;
+V8_EXPORT_PRIVATE void MemCopyUint16Uint8SSE2(uint16_t* dest,
+                                              const uint8_t* src, size_t chars);
+V8_EXPORT_PRIVATE void MemCopyUint8Uint16SSE2(uint8_t* dest,
+                                              const uint16_t* src,
+                                              size_t chars);
 #endif
 
 // Copy from 8bit/16bit chars to 8bit/16bit chars.
@@ -1547,6 +1592,22 @@ void CopyCharsUnsigned(uint16_t* dest, const uint16_t* src, size_t chars) {
   }
 }
 #undef CASE
+#elif defined(V8_HOST_ARCH_IA32) || defined(V8_HOST_ARCH_X64)
+void CopyCharsUnsigned(uint16_t* dest, const uint8_t* src, size_t chars) {
+  if (chars >= kMinSSE2ConvertCopy) {
+    MemCopyUint16Uint8SSE2(dest, src, chars);
+  } else {
+    for (size_t i = 0; i < chars; i++) dest[i] = src[i];
+  }
+}
+
+void CopyCharsUnsigned(uint8_t* dest, const uint16_t* src, size_t chars) {
+  if (chars >= kMinSSE2ConvertCopy) {
+    MemCopyUint8Uint16SSE2(dest, src, chars);
+  } else {
+    for (size_t i = 0; i < chars; i++) dest[i] = static_cast<uint8_t>(src[i]);
+  }
+}
 #endif
 
 
@@ -1775,6 +1775,9 @@ int DisassemblerX64::TwoByteOpcodeInstruction(byte* data) {
       } else if (opcode == 0x50) {
         AppendToBuffer("movmskpd %s,", NameOfCPURegister(regop));
         current += PrintRightXMMOperand(current);
+      } else if (opcode == 0xD7) {
+        AppendToBuffer("pmovmskb %s,", NameOfCPURegister(regop));
+        current += PrintRightXMMOperand(current);
       } else if (opcode == 0x70) {
         AppendToBuffer("pshufd %s,", NameOfXMMRegister(regop));
         current += PrintRightXMMOperand(current);
@@ -1844,8 +1847,6 @@ int DisassemblerX64::TwoByteOpcodeInstruction(byte* data) {
           mnemonic = "psrld";
         } else if (opcode == 0xD5) {
           mnemonic = "pmullw";
-        } else if (opcode == 0xD7) {
-          mnemonic = "pmovmskb";
         } else if (opcode == 0xD8) {
           mnemonic = "psubusb";
         } else if (opcode == 0xD9) {
@@ -16,14 +16,13 @@ namespace v8 {
 namespace internal {
 
 AccountingAllocator::AccountingAllocator() : unused_segments_mutex_() {
-  static const size_t kDefaultBucketMaxSize = 5;
-
   memory_pressure_level_.SetValue(MemoryPressureLevel::kNone);
   std::fill(unused_segments_heads_, unused_segments_heads_ + kNumberBuckets,
             nullptr);
   std::fill(unused_segments_sizes_, unused_segments_sizes_ + kNumberBuckets, 0);
-  std::fill(unused_segments_max_sizes_,
-            unused_segments_max_sizes_ + kNumberBuckets, kDefaultBucketMaxSize);
+  // With 1 MB buckets a fixed number of segments per bucket could pin a lot of
+  // memory, so default to the same limits as an isolate's allocator.
+  ConfigureSegmentPool(kMaxPoolSize);
 }
 
 AccountingAllocator::~AccountingAllocator() { ClearPool(); }
@@ -64,7 +63,7 @@ void AccountingAllocator::ConfigureSegmentPool(const size_t max_pool_size) {
     if (total_size + (size_t(1) << (power + kMinSegmentSizePower)) <=
         max_pool_size) {
       unused_segments_max_sizes_[power] = fits_fully + 1;
-      total_size += size_t(1) << power;
+      total_size += size_t(1) << (power + kMinSegmentSizePower);
     } else {
       unused_segments_max_sizes_[power] = fits_fully;
     }
@@ -73,7 +72,9 @@ void AccountingAllocator::ConfigureSegmentPool(const size_t max_pool_size) {
 
 Segment* AccountingAllocator::GetSegment(size_t bytes) {
   Segment* result = GetSegmentFromPool(bytes);
-  if (result == nullptr) {
+  if (result != nullptr) {
+    result->set_reused(true);
+  } else {
     result = AllocateSegment(bytes);
     if (result != nullptr) {
       result->Initialize(bytes);
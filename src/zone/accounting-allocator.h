@@ -21,7 +21,11 @@ namespace internal {
 
 class V8_EXPORT_PRIVATE AccountingAllocator {
  public:
-  static const size_t kMaxPoolSize = 8ul * KB;
+  // Default limit of the segment pool. It is large enough to keep one segment
+  // of each size class, including the 1 MB segments that big TurboFan zones
+  // grow to, so that back-to-back compilation jobs do not have to go through
+  // malloc and free for their zone memory.
+  static const size_t kMaxPoolSize = 2ul * MB;
 
   AccountingAllocator();
   virtual ~AccountingAllocator();
@@ -51,7 +55,7 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   FRIEND_TEST(Zone, SegmentPoolConstraints);
 
   static const size_t kMinSegmentSizePower = 13;
-  static const size_t kMaxSegmentSizePower = 18;
+  static const size_t kMaxSegmentSizePower = 20;
 
   STATIC_ASSERT(kMinSegmentSizePower <= kMaxSegmentSizePower);
 
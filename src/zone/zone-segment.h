@@ -20,7 +20,10 @@ class Zone;
 
 class Segment {
  public:
-  void Initialize(size_t size) { size_ = size; }
+  void Initialize(size_t size) {
+    size_ = size;
+    reused_ = false;
+  }
 
   Zone* zone() const { return zone_; }
   void set_zone(Zone* const zone) { zone_ = zone; }
@@ -31,6 +34,11 @@ class Segment {
   size_t size() const { return size_; }
   size_t capacity() const { return size_ - sizeof(Segment); }
 
+  // Whether the segment was handed out from the segment pool rather than
+  // freshly allocated.
+  bool reused() const { return reused_; }
+  void set_reused(bool reused) { reused_ = reused; }
+
   Address start() const { return address(sizeof(Segment)); }
   Address end() const { return address(size_); }
 
@@ -53,6 +61,7 @@ class Segment {
   Zone* zone_;
   Segment* next_;
   size_t size_;
+  bool reused_;
 };
 }  // namespace internal
 }  // namespace v8
@@ -46,6 +46,7 @@ Zone::Zone(AccountingAllocator* allocator, const char* name,
            SegmentSize segment_size)
     : allocation_size_(0),
       segment_bytes_allocated_(0),
+      segment_bytes_reused_(0),
       position_(0),
       limit_(0),
       allocator_(allocator),
@@ -119,6 +120,7 @@ Segment* Zone::NewSegment(size_t requested_size) {
   if (result != nullptr) {
     DCHECK_GE(result->size(), requested_size);
     segment_bytes_allocated_ += result->size();
+    if (result->reused()) segment_bytes_reused_ += result->size();
     result->set_zone(this);
     result->set_next(segment_head_);
     segment_head_ = result;
@@ -66,6 +66,10 @@ class V8_EXPORT_PRIVATE Zone final {
 
   size_t allocation_size() const { return allocation_size_; }
 
+  // The number of bytes in segments that were taken from the allocator's
+  // segment pool instead of being freshly allocated.
+  size_t segment_bytes_reused() const { return segment_bytes_reused_; }
+
   AccountingAllocator* allocator() const { return allocator_; }
 
  private:
@@ -92,6 +96,9 @@ class V8_EXPORT_PRIVATE Zone final {
   // the zone.
   size_t segment_bytes_allocated_;
 
+  // The number of bytes in segments reused from the segment pool.
+  size_t segment_bytes_reused_;
+
   // Expand the Zone to hold at least 'size' more bytes and allocate
   // the bytes. Returns the address of the newly allocated chunk of
   // memory in the Zone. Should only be called if there isn't enough
@@ -43,6 +43,10 @@ class InstructionSchedulerTester {
   }
   void CheckIsDeopt(Instruction* instr) { CHECK(instr->IsDeoptimizeCall()); }
 
+  int GetLatency(Instruction* instr) {
+    return InstructionScheduler::GetInstructionLatency(instr);
+  }
+
   void CheckInSuccessors(Instruction* instr, Instruction* successor) {
     InstructionScheduler::ScheduleGraphNode* node = GetNode(instr);
     InstructionScheduler::ScheduleGraphNode* succ_node = GetNode(successor);
@@ -110,6 +114,45 @@ TEST(DeoptInMiddleOfBasicBlock) {
   tester.EndBlock();
 }
 
+#if V8_TARGET_ARCH_X64
+TEST(InstructionLatencyX64) {
+  InstructionSchedulerTester tester;
+  Zone* zone = tester.zone();
+
+  InstructionOperand output =
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 0);
+  InstructionOperand input =
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 1);
+  auto make = [&](InstructionCode opcode) {
+    return Instruction::New(zone, opcode, 1, &output, 1, &input, 0, nullptr);
+  };
+  InstructionCode memory = AddressingModeField::encode(kMode_MR);
+
+  // Register forms.
+  Instruction* add = make(kX64Add);
+  Instruction* mul = make(kAVXFloat64Mul);
+  Instruction* lea = make(kX64Lea | memory);
+  // Memory forms have to wait for the load.
+  Instruction* load = make(kX64Movq | memory);
+  Instruction* add_load = make(kX64Add | memory);
+  // Stores and compares against memory have no output.
+  InstructionOperand inputs[] = {input, input};
+  Instruction* store = Instruction::New(zone, kX64Movq | memory, 0, nullptr,
+                                        2, inputs, 0, nullptr);
+  Instruction* cmp_load = Instruction::New(zone, kX64Cmp | memory, 0, nullptr,
+                                           2, inputs, 0, nullptr);
+
+  CHECK_EQ(1, tester.GetLatency(add));
+  CHECK_LT(1, tester.GetLatency(mul));
+  CHECK_EQ(1, tester.GetLatency(lea));
+  CHECK_LT(tester.GetLatency(add), tester.GetLatency(load));
+  CHECK_LT(tester.GetLatency(load), tester.GetLatency(add_load));
+  CHECK_LT(0, tester.GetLatency(store));
+  CHECK_LT(tester.GetLatency(store), tester.GetLatency(load));
+  CHECK_EQ(tester.GetLatency(add_load), tester.GetLatency(cmp_load));
+}
+#endif  // V8_TARGET_ARCH_X64
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -1372,6 +1372,225 @@ TEST(CompilationCacheCachingBehavior) {
 }
 
 
+TEST(CompilationCacheRegExpSurvivesAging) {
+  // If we do not have the compilation cache turned off, this test is invalid.
+  if (!FLAG_compilation_cache) {
+    return;
+  }
+  FLAG_regexp_persistent_cache_size = 256;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  CompilationCache* compilation_cache = isolate->compilation_cache();
+
+  v8::HandleScope scope(CcTest::isolate());
+  Handle<String> source = factory->InternalizeUtf8String("(a+)b");
+  JSRegExp::Flags flags = JSRegExp::kGlobal;
+
+  {
+    v8::HandleScope scope(CcTest::isolate());
+    CompileRun("new RegExp('(a+)b', 'g').exec('aab');");
+  }
+  CHECK(!compilation_cache->LookupRegExp(source, flags).is_null());
+
+  // Reusing the regexp after a GC makes the entry persistent.
+  CcTest::CollectAllGarbage();
+  CHECK(!compilation_cache->LookupRegExp(source, flags).is_null());
+
+  // Without further lookups, the entry would have been aged out by now.
+  const int kGCs = 4;
+  for (int i = 0; i < kGCs; i++) CcTest::CollectAllGarbage();
+  CHECK(!compilation_cache->LookupRegExp(source, flags).is_null());
+
+  // Unlike entries that are not reused.
+  Handle<String> other_source = factory->InternalizeUtf8String("(c+)d");
+  {
+    v8::HandleScope scope(CcTest::isolate());
+    CompileRun("new RegExp('(c+)d', 'g').exec('ccd');");
+  }
+  for (int i = 0; i < kGCs; i++) CcTest::CollectAllGarbage();
+  CHECK(compilation_cache->LookupRegExp(other_source, flags).is_null());
+}
+
+TEST(CompilationCacheRegExpPersistentEviction) {
+  // If we do not have the compilation cache turned off, this test is invalid.
+  if (!FLAG_compilation_cache) {
+    return;
+  }
+  FLAG_regexp_persistent_cache_size = 4;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  CompilationCache* compilation_cache = isolate->compilation_cache();
+  compilation_cache->Clear();
+
+  v8::HandleScope scope(CcTest::isolate());
+  JSRegExp::Flags flags = JSRegExp::kGlobal;
+  const int kRegExps = 10;
+  Handle<String> sources[kRegExps];
+  for (int i = 0; i < kRegExps; i++) {
+    EmbeddedVector<char, 64> source;
+    SNPrintF(source, "(a+)b%d", i);
+    sources[i] = factory->InternalizeUtf8String(source.start());
+    {
+      v8::HandleScope scope(CcTest::isolate());
+      EmbeddedVector<char, 128> script;
+      SNPrintF(script, "new RegExp('%s', 'g').exec('aab%d');", source.start(),
+               i);
+      CompileRun(script.start());
+    }
+    // Reusing the regexp after a GC makes the entry persistent.
+    CcTest::CollectAllGarbage();
+    CHECK(!compilation_cache->LookupRegExp(sources[i], flags).is_null());
+  }
+
+  // Age the entries out of the generational cache.
+  const int kGCs = 4;
+  for (int i = 0; i < kGCs; i++) CcTest::CollectAllGarbage();
+
+  // Filling the cache past its limit evicted the least recently used
+  // entries, and kept the most recently used ones.
+  for (int i = 0; i < kRegExps - FLAG_regexp_persistent_cache_size; i++) {
+    CHECK(compilation_cache->LookupRegExp(sources[i], flags).is_null());
+  }
+  CHECK(!compilation_cache->LookupRegExp(sources[kRegExps - 1], flags)
+             .is_null());
+
+  // Entries that no context uses are retired as contexts are disposed.
+  isolate->heap()->NotifyContextDisposed(true);
+  isolate->heap()->NotifyContextDisposed(true);
+  CHECK(compilation_cache->LookupRegExp(sources[kRegExps - 1], flags)
+            .is_null());
+}
+
+TEST(BytecodeFlushing) {
+  FLAG_always_opt = false;
+  FLAG_flush_bytecode = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  v8::HandleScope scope(CcTest::isolate());
+
+  CompileRun(
+      "function foo(x) { return x + 1; }"
+      "function bar(x) { return x + 2; }"
+      "foo(1); bar(1);");
+
+  Handle<JSFunction> foo = Handle<JSFunction>::cast(
+      Object::GetProperty(isolate->global_object(),
+                          factory->InternalizeUtf8String("foo"))
+          .ToHandleChecked());
+  Handle<JSFunction> bar = Handle<JSFunction>::cast(
+      Object::GetProperty(isolate->global_object(),
+                          factory->InternalizeUtf8String("bar"))
+          .ToHandleChecked());
+  CHECK(foo->is_compiled());
+  CHECK(bar->is_compiled());
+
+  // Only foo's bytecode is old enough to be flushed.
+  foo->shared()->GetBytecodeArray()->set_bytecode_age(
+      BytecodeArray::kIsOldBytecodeAge);
+  bar->shared()->GetBytecodeArray()->set_bytecode_age(
+      BytecodeArray::kNoAgeBytecodeAge);
+  CcTest::CollectAllAvailableGarbage();
+  CHECK(!foo->shared()->is_compiled());
+  CHECK(!foo->is_compiled());
+  CHECK(bar->shared()->is_compiled());
+  CHECK(bar->is_compiled());
+
+  // A flushed function is recompiled lazily on its next call.
+  v8::Local<v8::Context> context = CcTest::isolate()->GetCurrentContext();
+  CHECK_EQ(3, CompileRun("foo(2)")->Int32Value(context).FromJust());
+  CHECK(foo->is_compiled());
+}
+
+
+TEST(BytecodeFlushingAge) {
+  FLAG_always_opt = false;
+  FLAG_flush_bytecode = true;
+  FLAG_flush_bytecode_age = 5;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  v8::HandleScope scope(CcTest::isolate());
+
+  CompileRun("function foo(x) { return x + 1; } foo(1);");
+  Handle<JSFunction> foo = Handle<JSFunction>::cast(
+      Object::GetProperty(isolate->global_object(),
+                          factory->InternalizeUtf8String("foo"))
+          .ToHandleChecked());
+
+  // Old, but not as old as the flag asks for.
+  foo->shared()->GetBytecodeArray()->set_bytecode_age(
+      BytecodeArray::kSeptuagenarianBytecodeAge);
+  isolate->heap()->FlushOldBytecode();
+  CHECK(foo->is_compiled());
+
+  foo->shared()->GetBytecodeArray()->set_bytecode_age(
+      BytecodeArray::kOctogenarianBytecodeAge);
+  isolate->heap()->FlushOldBytecode();
+  CHECK(!foo->is_compiled());
+  CHECK(foo->shared()->has_flushed_bytecode());
+
+  v8::Local<v8::Context> context = CcTest::isolate()->GetCurrentContext();
+  CHECK_EQ(3, CompileRun("foo(2)")->Int32Value(context).FromJust());
+  CHECK(!foo->shared()->has_flushed_bytecode());
+}
+
+
+TEST(BytecodeFlushingDropsStaleFeedback) {
+  FLAG_always_opt = false;
+  FLAG_flush_bytecode = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  v8::HandleScope scope(CcTest::isolate());
+  v8::Local<v8::Context> context = CcTest::isolate()->GetCurrentContext();
+
+  // The feedback cell for {inner} in {outer}'s feedback vector keeps
+  // {inner}'s feedback vector after the closure is gone.
+  CompileRun(
+      "function outer() { return function inner(o) { return o.x; }; }"
+      "var f = outer(); f({x: 1}); f({x: 2});");
+  Handle<JSFunction> outer = Handle<JSFunction>::cast(
+      Object::GetProperty(isolate->global_object(),
+                          factory->InternalizeUtf8String("outer"))
+          .ToHandleChecked());
+  Handle<JSFunction> inner = Handle<JSFunction>::cast(
+      Object::GetProperty(isolate->global_object(),
+                          factory->InternalizeUtf8String("f"))
+          .ToHandleChecked());
+  Handle<SharedFunctionInfo> shared(inner->shared(), isolate);
+  Handle<FeedbackCell> cell(inner->feedback_cell(), isolate);
+  CHECK(cell->value()->IsFeedbackVector());
+  inner = Handle<JSFunction>();
+  CompileRun("f = undefined;");
+
+  outer->shared()->GetBytecodeArray()->set_bytecode_age(
+      BytecodeArray::kNoAgeBytecodeAge);
+  shared->GetBytecodeArray()->set_bytecode_age(
+      BytecodeArray::kIsOldBytecodeAge);
+  isolate->heap()->FlushOldBytecode();
+  CHECK(!shared->is_compiled());
+  CHECK(outer->shared()->is_compiled());
+  // The vector was built against the flushed feedback metadata.
+  CHECK(cell->value()->IsUndefined(isolate));
+
+  // A new closure gets a vector that matches the recompiled function.
+  CHECK_EQ(3, CompileRun("var g = outer(); g({x: 3})")
+                  ->Int32Value(context)
+                  .FromJust());
+  CHECK(shared->is_compiled());
+  Handle<JSFunction> g = Handle<JSFunction>::cast(
+      Object::GetProperty(isolate->global_object(),
+                          factory->InternalizeUtf8String("g"))
+          .ToHandleChecked());
+  CHECK_EQ(*shared, g->shared());
+  CHECK_EQ(shared->feedback_metadata(), g->feedback_vector()->metadata());
+  CHECK_EQ(4, CompileRun("g({x: 4})")->Int32Value(context).FromJust());
+}
+
+
 static void OptimizeEmptyFunction(const char* name) {
   HandleScope scope(CcTest::i_isolate());
   EmbeddedVector<char, 256> source;
@@ -15451,8 +15451,6 @@ TEST(CompileExternalTwoByteSource) {
 }
 
 
-#ifndef V8_INTERPRETED_REGEXP
-
 struct RegExpInterruptionData {
   v8::base::Atomic32 loop_count;
   UC16VectorResource* string_resource;
@@ -15500,7 +15498,7 @@ void RunBeforeGC(v8::Isolate* isolate, v8::GCType type,
 // * interrupting with GC
 // * turn the subject string from one-byte internal to two-byte external string
 // * force termination
-TEST(RegExpInterruption) {
+static void RunRegExpInterruptionTest() {
   LocalContext env;
   v8::HandleScope scope(env->GetIsolate());
 
@@ -15528,7 +15526,19 @@ TEST(RegExpInterruption) {
   i::DeleteArray(uc16_content);
 }
 
-#endif  // V8_INTERPRETED_REGEXP
+
+TEST(RegExpInterruption) {
+  i::FLAG_regexp_tier_up = false;
+  RunRegExpInterruptionTest();
+}
+
+
+// The bytecode interpreter, which tier-up runs first, must be interruptible
+// as well.
+TEST(RegExpInterruptionInterpreted) {
+  i::FLAG_regexp_tier_up = true;
+  RunRegExpInterruptionTest();
+}
 
 
 // Test that we cannot set a property on the global object if there
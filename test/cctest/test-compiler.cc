@@ -786,6 +786,29 @@ TEST(InvocationCount) {
   CHECK_EQ(4, foo->feedback_vector()->invocation_count());
 }
 
+TEST(LazyFeedbackAllocation) {
+  FLAG_always_opt = false;
+  FLAG_lazy_feedback_allocation = true;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+
+  // Top-level closures are created by the runtime. Running the script again
+  // reuses the cached, and by now compiled, function.
+  const char* source = "var f = function() { return 1; };";
+  CompileRun(source);
+  CompileRun("f()");
+  CompileRun(source);
+  Handle<JSFunction> f = Handle<JSFunction>::cast(GetGlobalProperty("f"));
+  CHECK(f->shared()->is_compiled());
+  CHECK(!f->has_feedback_vector());
+  CHECK(!f->is_compiled());
+
+  CompileRun("f()");
+  CHECK(f->has_feedback_vector());
+  CHECK(f->is_compiled());
+  CHECK_EQ(1, f->feedback_vector()->invocation_count());
+}
+
 TEST(ShallowEagerCompilation) {
   i::FLAG_always_opt = false;
   CcTest::InitializeVM();
@@ -389,6 +389,7 @@ TEST(DisasmX64) {
     __ movdqa(Operand(rsp, 12), xmm0);
     __ movdqu(xmm0, Operand(rsp, 12));
     __ movdqu(Operand(rsp, 12), xmm0);
+    __ pmovmskb(r9, xmm4);
     __ shufps(xmm0, xmm9, 0x0);
 
     // logic operation
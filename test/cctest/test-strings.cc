@@ -1154,6 +1154,49 @@ TEST(CachedHashOverflow) {
 }
 
 
+TEST(HashIndependentOfRepresentation) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  v8::HandleScope scope(CcTest::isolate());
+  uint32_t seed = isolate->heap()->HashSeed();
+
+  static const int kMaxLength = 100;
+  uint8_t one_byte[kMaxLength];
+  uc16 two_byte[kMaxLength];
+  for (int length = 0; length <= kMaxLength; length++) {
+    for (int i = 0; i < length; i++) {
+      one_byte[i] = static_cast<uint8_t>('a' + (i * 7 + length) % 26);
+      two_byte[i] = one_byte[i];
+    }
+    uint32_t hash =
+        StringHasher::HashSequentialString(one_byte, length, seed);
+    CHECK_EQ(hash, StringHasher::HashSequentialString(two_byte, length, seed));
+
+    int utf16_length;
+    Vector<const char> utf8(reinterpret_cast<const char*>(one_byte), length);
+    CHECK_EQ(hash, StringHasher::ComputeUtf8Hash(utf8, seed, &utf16_length));
+    CHECK_EQ(length, utf16_length);
+
+    // Strings made of several pieces hash like flat strings, whatever the
+    // position of the split.
+    for (int split = 1; split < length; split++) {
+      Handle<String> left =
+          factory->NewStringFromOneByte(Vector<const uint8_t>(one_byte, split))
+              .ToHandleChecked();
+      // A two-byte string, even though all its characters are one-byte.
+      Handle<SeqTwoByteString> right =
+          factory->NewRawTwoByteString(length - split).ToHandleChecked();
+      CopyChars(right->GetChars(), two_byte + split, length - split);
+      Handle<String> cons =
+          factory->NewConsString(left, right).ToHandleChecked();
+      cons->Hash();
+      CHECK_EQ(hash, cons->hash_field());
+    }
+  }
+}
+
+
 TEST(SliceFromCons) {
   if (!FLAG_string_slices) return;
   CcTest::InitializeVM();
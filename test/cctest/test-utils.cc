@@ -191,6 +191,53 @@ TEST(MemMove) {
 }
 
 
+TEST(CopyCharsWidenAndNarrow) {
+  static const int kMaxLength = 80;
+  uint8_t one_byte[kMaxLength + 8];
+  uint16_t two_byte[kMaxLength + 8];
+  for (int offset = 0; offset < 4; offset++) {
+    for (int length = 0; length <= kMaxLength; length++) {
+      uint8_t* narrow = one_byte + offset;
+      uint16_t* wide = two_byte + offset;
+      for (int i = 0; i < length; i++) narrow[i] = (i * 37 + length) & 0xFF;
+      memset(wide, 0xAB, length * sizeof(*wide));
+      CopyChars(wide, narrow, length);
+      for (int i = 0; i < length; i++) CHECK_EQ(narrow[i], wide[i]);
+
+      // Narrowing keeps the low byte of characters outside one-byte range.
+      for (int i = 0; i < length; i++) wide[i] = 0x100 * i + (i ^ offset);
+      memset(narrow, 0, length);
+      CopyChars(narrow, wide, length);
+      for (int i = 0; i < length; i++) {
+        CHECK_EQ(static_cast<uint8_t>(wide[i]), narrow[i]);
+      }
+    }
+  }
+}
+
+
+TEST(NonOneByteStart) {
+  static const int kMaxLength = 40;
+  uc16 chars[kMaxLength + 4];
+  for (int offset = 0; offset < 4; offset++) {
+    for (int length = 0; length <= kMaxLength; length++) {
+      uc16* start = chars + offset;
+      for (int i = 0; i < length; i++) start[i] = 0xFF;
+      CHECK(String::IsOneByte(start, length));
+      CHECK_EQ(length, String::NonOneByteStart(start, length));
+      for (int i = 0; i < length; i++) {
+        start[i] = 0x100;
+        CHECK(!String::IsOneByte(start, length));
+        int non_one_byte_start = String::NonOneByteStart(start, length);
+        CHECK_LE(non_one_byte_start, i);
+        CHECK_GT(non_one_byte_start + static_cast<int>(kPointerSize), i);
+        start[i] = 0xFF;
+      }
+    }
+  }
+}
+
+
 TEST(Collector) {
   Collector<int> collector(8);
   const int kLoops = 5;
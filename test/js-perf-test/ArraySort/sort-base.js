@@ -73,6 +73,16 @@ function CreatePackedObjectArray() {
   AssertPackedObjectElements();
 }
 
+function CreatePackedSmiFewUniqueArray() {
+  array_to_sort = Array.from(template_array, (x,_) => x % 10);
+  AssertPackedSmiElements();
+}
+
+function CreatePackedTwoByteStringArray() {
+  array_to_sort = Array.from(template_array, (x,_) => `\u03b1 ${x}`);
+  AssertPackedObjectElements();
+}
+
 function CreateHoleySmiArray() {
   array_to_sort = new Array(kArraySize);
   for (let i = 0; i < kArraySize; ++i) {
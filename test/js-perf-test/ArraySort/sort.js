@@ -7,6 +7,8 @@ load('sort-base.js');
 benchy('PackedSmi', Sort, CreatePackedSmiArray);
 benchy('PackedDouble', Sort, CreatePackedDoubleArray);
 benchy('PackedElement', Sort, CreatePackedObjectArray);
+benchy('PackedSmiFewUnique', Sort, CreatePackedSmiFewUniqueArray);
+benchy('PackedTwoByteString', Sort, CreatePackedTwoByteStringArray);
 
 benchy('HoleySmi', Sort, CreateHoleySmiArray);
 benchy('HoleyDouble', Sort, CreateHoleyDoubleArray);
@@ -0,0 +1,24 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+function CreateParseBenchmark(name, payload) {
+  let json;
+  function Setup() { json = payload; }
+  function Parse() {
+    let result = JSON.parse(json);
+    if (typeof result !== 'object') throw new Error('Unexpected result');
+  }
+  function TearDown() { json = undefined; }
+  return new BenchmarkSuite(name, [1000], [
+    new Benchmark(name, false, false, 0, Parse, Setup, TearDown)
+  ]);
+}
+
+CreateParseBenchmark('ParseUsers', JSON.stringify(kUsers));
+CreateParseBenchmark('ParseUsersIndented', JSON.stringify(kUsers, null, 2));
+CreateParseBenchmark('ParseMessages', JSON.stringify(kMessages));
+CreateParseBenchmark('ParseNumbers', JSON.stringify(kNumbers));
+// The parsed users have already taught the root map other first keys, so
+// the records can't rely on a single expected transition.
+CreateParseBenchmark('ParseRecords', JSON.stringify(kRecords));
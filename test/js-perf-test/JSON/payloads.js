@@ -0,0 +1,100 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Deterministic generators for API-response-like JSON payloads.
+
+let seed = 42;
+function random() {
+  seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+  return seed / 0x80000000;
+}
+
+function randomWord(length) {
+  let word = '';
+  for (let i = 0; i < length; ++i) {
+    word += String.fromCharCode(97 + Math.floor(random() * 26));
+  }
+  return word;
+}
+
+function randomSentence(words) {
+  let sentence = [];
+  for (let i = 0; i < words; ++i) {
+    sentence.push(randomWord(2 + Math.floor(random() * 8)));
+  }
+  return sentence.join(' ');
+}
+
+function CreateUser(id) {
+  return {
+    id: id,
+    login: randomWord(8),
+    name: randomSentence(2),
+    email: randomWord(6) + '@' + randomWord(5) + '.com',
+    verified: random() < 0.5,
+    score: Math.floor(random() * 1e6) / 100,
+    created_at: 1500000000000 + Math.floor(random() * 1e10),
+    tags: [randomWord(4), randomWord(5), randomWord(6)],
+    profile: {
+      bio: randomSentence(12),
+      location: randomSentence(2),
+      followers: Math.floor(random() * 100000),
+      url: 'https://example.com/' + randomWord(10),
+    },
+  };
+}
+
+function CreateUsers(count) {
+  let users = [];
+  for (let i = 0; i < count; ++i) users.push(CreateUser(i));
+  return users;
+}
+
+function CreateMessages(count) {
+  // Strings with escapes and non-ASCII characters.
+  let messages = [];
+  for (let i = 0; i < count; ++i) {
+    messages.push({
+      id: i,
+      text: randomSentence(20) + '\n\t"' + randomWord(5) + '"\\' +
+            randomSentence(5),
+      author: randomWord(7) + ' éè',
+    });
+  }
+  return messages;
+}
+
+function CreateNumbers(count) {
+  let numbers = [];
+  for (let i = 0; i < count; ++i) {
+    numbers.push(Math.floor(random() * 1e6));
+    numbers.push(1500000000000 + Math.floor(random() * 1e10));
+    numbers.push(random() * 1000);
+  }
+  return numbers;
+}
+
+const kUsers = CreateUsers(1000);
+const kMessages = CreateMessages(1000);
+const kNumbers = CreateNumbers(5000);
+
+function CreateRecords(count) {
+  // Flat records, as returned by e.g. a database query.
+  let records = [];
+  for (let i = 0; i < count; ++i) {
+    records.push({
+      order_id: i,
+      customer: randomWord(8),
+      status: random() < 0.5 ? 'open' : 'closed',
+      amount: Math.floor(random() * 100000) / 100,
+      currency: 'EUR',
+      quantity: Math.floor(random() * 10),
+      created_at: 1500000000000 + Math.floor(random() * 1e10),
+      shipped: random() < 0.5,
+    });
+  }
+  return records;
+}
+
+const kRecords = CreateRecords(5000);
@@ -0,0 +1,21 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+function CreateStringifyBenchmark(name, payload) {
+  let value;
+  function Setup() { value = payload; }
+  function Stringify() {
+    let result = JSON.stringify(value);
+    if (typeof result !== 'string') throw new Error('Unexpected result');
+  }
+  function TearDown() { value = undefined; }
+  return new BenchmarkSuite(name, [1000], [
+    new Benchmark(name, false, false, 0, Stringify, Setup, TearDown)
+  ]);
+}
+
+CreateStringifyBenchmark('StringifyUsers', kUsers);
+CreateStringifyBenchmark('StringifyMessages', kMessages);
+CreateStringifyBenchmark('StringifyNumbers', kNumbers);
+CreateStringifyBenchmark('StringifyRecords', kRecords);
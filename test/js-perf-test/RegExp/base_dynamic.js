@@ -0,0 +1,40 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+load("base.js");
+
+// Regexps built at runtime from varying input, e.g. user-supplied filters.
+// Each pattern is distinct, so nothing is shared through the compilation
+// cache and every regexp is compiled from scratch.
+
+var counter = 0;
+var str = createHaystack();
+
+function nextFilter() {
+  return "(ab|cd)[Cc]\\w*?" + (counter++) + "|^[a-f]+z$";
+}
+
+function DynamicTest() {
+  new RegExp(nextFilter()).test(str);
+}
+
+function DynamicExec() {
+  new RegExp(nextFilter(), "i").exec(str);
+}
+
+function DynamicReplace() {
+  str.replace(new RegExp(nextFilter(), "g"), "-");
+}
+
+// The same filter applied many times, which should end up in native code.
+function HotFilter() {
+  var re = new RegExp("(ab|cd)[Cc]\\w*?z|^[a-f]+z$");
+  for (var i = 0; i < 100; i++) re.exec(str);
+}
+
+var benchmarks = [ [DynamicTest, undefined],
+                   [DynamicExec, undefined],
+                   [DynamicReplace, undefined],
+                   [HotFilter, undefined],
+                 ];
@@ -6,6 +6,7 @@
 load('../base.js');
 
 load('ctor.js');
+load('dynamic.js');
 load('exec.js');
 load('flags.js');
 load('match.js');
@@ -0,0 +1,70 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('StringConcatAppend', [5], [
+  new Benchmark('StringConcatAppend', true, false, 0, StringConcatAppend),
+]);
+
+new BenchmarkSuite('StringConcatAppendTwoByte', [5], [
+  new Benchmark('StringConcatAppendTwoByte', true, false, 0,
+  StringConcatAppendTwoByte),
+]);
+
+new BenchmarkSuite('StringConcatPrepend', [5], [
+  new Benchmark('StringConcatPrepend', true, false, 0, StringConcatPrepend),
+]);
+
+new BenchmarkSuite('StringConcatTemplate', [5], [
+  new Benchmark('StringConcatTemplate', true, false, 0, StringConcatTemplate),
+]);
+
+// Pieces long enough that each += creates a cons string.
+const oneBytePieces = [];
+const twoBytePieces = [];
+for (var i = 0; i < 16; ++i) {
+  oneBytePieces.push('<span class="item">' + i + '</span>');
+  twoBytePieces.push('<span class="\u2018item\u2019">' + i + '</span>');
+}
+
+function Append(pieces) {
+  var s = '';
+  for (var i = 0; i < 1000; ++i) {
+    s += pieces[i & 15];
+  }
+  // Flatten the string.
+  return s.charCodeAt(s.length >> 1);
+}
+
+function StringConcatAppend() {
+  return Append(oneBytePieces);
+}
+
+function StringConcatAppendTwoByte() {
+  return Append(twoBytePieces);
+}
+
+function StringConcatPrepend() {
+  var s = '';
+  for (var i = 0; i < 1000; ++i) {
+    s = oneBytePieces[i & 15] + s;
+  }
+  return s.charCodeAt(s.length >> 1);
+}
+
+// Appends rows to a document and looks at the result every once in a while,
+// which flattens the partial result.
+function StringConcatTemplate() {
+  var s = '<table>';
+  var rows = 0;
+  for (var i = 0; i < 200; ++i) {
+    s += '<tr>';
+    for (var j = 0; j < 5; ++j) {
+      s += '<td>' + oneBytePieces[(i + j) & 15] + '</td>';
+    }
+    s += '</tr>\n';
+    if ((i & 31) == 0 && s.endsWith('</tr>\n')) ++rows;
+  }
+  s += '</table>';
+  return s.indexOf('</table>') + rows;
+}
@@ -0,0 +1,49 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Searches in long log-like subjects, for patterns of increasing length
+// whose first character is frequent in the subject.
+
+function CreateSubject(two_byte) {
+  var line = "2018-06-01 12:00:00 INFO request served in 12ms\n";
+  var lines = [];
+  for (var i = 0; i < 20000; i++) lines.push(line);
+  if (two_byte) lines.push("…");
+  lines.push("2018-06-01 12:00:01 ERROR failed\n");
+  return lines.join("");
+}
+
+const one_byte_subject = CreateSubject(false);
+const two_byte_subject = CreateSubject(true);
+
+function DefineSuites(length) {
+  const pattern = " ERROR failed".substring(0, length);
+  function Search(subject) {
+    return function() {
+      if (subject.indexOf(pattern) < 0) throw new Error("not found");
+      if (!subject.includes(pattern)) throw new Error("not found");
+    };
+  }
+  new BenchmarkSuite('StringSearchOneByte' + length, [5], [
+    new Benchmark('StringSearchOneByte' + length, false, false, 0,
+                  Search(one_byte_subject)),
+  ]);
+  new BenchmarkSuite('StringSearchTwoByte' + length, [5], [
+    new Benchmark('StringSearchTwoByte' + length, false, false, 0,
+                  Search(two_byte_subject)),
+  ]);
+}
+
+DefineSuites(2);
+DefineSuites(4);
+DefineSuites(6);
+DefineSuites(13);
+
+new BenchmarkSuite('StringSplitLongSubject', [5], [
+  new Benchmark('StringSplitLongSubject', false, false, 0, function() {
+    if (one_byte_subject.split(" ERROR").length != 2) {
+      throw new Error("wrong split");
+    }
+  }),
+]);
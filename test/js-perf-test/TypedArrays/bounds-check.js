@@ -0,0 +1,79 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('BoundsCheck', [1000], [
+  new Benchmark('BoundsCheck-Sum', false, false, 0,
+                BoundsCheckSum, BoundsCheckSetup, BoundsCheckTearDown),
+  new Benchmark('BoundsCheck-Dot', false, false, 0,
+                BoundsCheckDot, BoundsCheckSetup, BoundsCheckTearDown),
+  new Benchmark('BoundsCheck-Saxpy', false, false, 0,
+                BoundsCheckSaxpy, BoundsCheckSetup, BoundsCheckTearDown),
+  new Benchmark('BoundsCheck-PrefixSum', false, false, 0,
+                BoundsCheckPrefixSum, BoundsCheckSetup, BoundsCheckTearDown),
+]);
+
+const kLength = 10000;
+var int32Array;
+var float64ArrayX;
+var float64ArrayY;
+var result;
+
+function BoundsCheckSetup() {
+  int32Array = new Int32Array(kLength);
+  float64ArrayX = new Float64Array(kLength);
+  float64ArrayY = new Float64Array(kLength);
+  for (let i = 0; i < kLength; ++i) {
+    int32Array[i] = i & 0xff;
+    float64ArrayX[i] = i * 0.5;
+    float64ArrayY[i] = i * 0.25;
+  }
+}
+
+function BoundsCheckTearDown() {
+  if (typeof result !== 'number' || isNaN(result)) {
+    throw new TypeError('Unexpected result: ' + result);
+  }
+  int32Array = void 0;
+  float64ArrayX = void 0;
+  float64ArrayY = void 0;
+}
+
+function Sum(a) {
+  let s = 0;
+  for (let i = 0; i < a.length; ++i) s = (s + a[i]) | 0;
+  return s;
+}
+
+function Dot(x, y) {
+  const n = x.length;
+  let s = 0;
+  for (let i = 0; i < n; ++i) s += x[i] * y[i];
+  return s;
+}
+
+function Saxpy(alpha, x, y) {
+  for (let i = 0; i < y.length; ++i) y[i] = y[i] + alpha * x[i];
+  return y[0];
+}
+
+function PrefixSum(a) {
+  for (let i = 1; i < a.length; ++i) a[i] = (a[i] + a[i - 1]) | 0;
+  return a[a.length - 1];
+}
+
+function BoundsCheckSum() {
+  result = Sum(int32Array);
+}
+
+function BoundsCheckDot() {
+  result = Dot(float64ArrayX, float64ArrayY);
+}
+
+function BoundsCheckSaxpy() {
+  result = Saxpy(2.0, float64ArrayX, float64ArrayY);
+}
+
+function BoundsCheckPrefixSum() {
+  result = PrefixSum(int32Array);
+}
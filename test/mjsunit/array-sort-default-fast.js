@@ -0,0 +1,47 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Packed Smi arrays are sorted by their string representation.
+(function() {
+  var a = [10, 9, 1, -1, 100, 0, -10, 2];
+  assertTrue(%HasSmiElements(a));
+  a.sort();
+  assertEquals([-1, -10, 0, 1, 10, 100, 2, 9], a);
+})();
+
+// Packed double arrays keep 0 and -0 in their original order.
+(function() {
+  var a = [1.5, -0, 0.25, 0, NaN, -Infinity, 1e21, Infinity];
+  assertTrue(%HasDoubleElements(a));
+  a.sort();
+  assertEquals("-Infinity,0,0,0.25,1.5,1e+21,Infinity,NaN", a.join());
+  assertEquals(-Infinity, 1 / a[1]);
+  assertEquals(Infinity, 1 / a[2]);
+})();
+
+// Packed string arrays, including cons and two-byte strings.
+(function() {
+  var cons = "b" + "cdefghijklmnopqrstuvwxyz";
+  var a = [cons, "α", "a", "ab", "", "B", "aα"];
+  a.sort();
+  assertEquals(["", "B", "a", "ab", "aα", cons, "α"], a);
+})();
+
+// Mixed packed arrays fall back to the generic sort.
+(function() {
+  var a = ["b", 3, "a", 20];
+  a.sort();
+  assertEquals([20, 3, "a", "b"], a);
+})();
+
+// Copy-on-write literals are copied before sorting.
+(function() {
+  function f() { return [3, 2, 1]; }
+  var a = f();
+  a.sort();
+  assertEquals([1, 2, 3], a);
+  assertEquals([3, 2, 1], f());
+})();
@@ -0,0 +1,93 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+
+// Typed array access guarded by the loop condition.
+(function() {
+  function sum(a) {
+    let s = 0;
+    for (let i = 0; i < a.length; ++i) s += a[i];
+    return s;
+  }
+
+  const a = new Int32Array([1, 2, 3, 4, 5, 6, 7, 8]);
+  assertEquals(36, sum(a));
+  assertEquals(36, sum(a));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(36, sum(a));
+  assertEquals(0, sum(new Int32Array(0)));
+  assertOptimized(sum);
+})();
+
+// Array access guarded by a length loaded before the loop.
+(function() {
+  function dot(a, b) {
+    const n = a.length;
+    let s = 0;
+    for (let i = 0; i < n; ++i) s += a[i] * b[i];
+    return s;
+  }
+
+  const a = [1, 2, 3, 4];
+  const b = [4, 3, 2, 1];
+  assertEquals(20, dot(a, b));
+  assertEquals(20, dot(a, b));
+  %OptimizeFunctionOnNextCall(dot);
+  assertEquals(20, dot(a, b));
+  // The access to {b} is not guarded by the loop condition and must still be
+  // bounds checked.
+  assertEquals(NaN, dot(a, [1]));
+})();
+
+// Access guarded by a condition inside the loop body.
+(function() {
+  function foo(a, n) {
+    let s = 0;
+    for (let i = 0; i < n; ++i) {
+      if (i < a.length) s += a[i];
+    }
+    return s;
+  }
+
+  const a = new Float64Array([0.5, 1.5, 2.5]);
+  assertEquals(4.5, foo(a, 3));
+  assertEquals(4.5, foo(a, 3));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(4.5, foo(a, 10));
+  assertEquals(1.5, foo(new Float64Array([1.5]), 10));
+})();
+
+// Out-of-bounds accesses with a non-strict loop condition must still be
+// detected.
+(function() {
+  function foo(a) {
+    let s = 0;
+    for (let i = 0; i <= a.length; ++i) s += a[i];
+    return s;
+  }
+
+  const a = new Int32Array([1, 2, 3]);
+  assertEquals(NaN, foo(a));
+  assertEquals(NaN, foo(a));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(NaN, foo(a));
+})();
+
+// Mutating the array inside the loop reloads the length.
+(function() {
+  function foo(a) {
+    let s = 0;
+    for (let i = 0; i < a.length; ++i) {
+      s += a[i];
+      a.length = 1;
+    }
+    return s;
+  }
+
+  assertEquals(1, foo([1, 2, 3]));
+  assertEquals(1, foo([1, 2, 3]));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(1, foo([1, 2, 3]));
+})();
@@ -0,0 +1,58 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt --max-same-site-deopts=2
+
+// Deopts at different sites don't count as a deopt loop.
+(function() {
+  function foo(a, b) { return [a + 1, b + 1]; }
+
+  foo(1, 1);
+  foo(1, 1);
+  %OptimizeFunctionOnNextCall(foo);
+  foo(1, 1);
+  assertOptimized(foo);
+  foo("a", 1);
+  assertUnoptimized(foo);
+
+  %OptimizeFunctionOnNextCall(foo);
+  foo(1, 1);
+  assertOptimized(foo);
+  foo(1, "b");
+  assertUnoptimized(foo);
+
+  %OptimizeFunctionOnNextCall(foo);
+  foo(1, 1);
+  assertOptimized(foo);
+})();
+
+// Repeated deopts at the same site generalize the feedback there, so the
+// next optimization no longer speculates on the property access.
+(function() {
+  function bar(o) { return o.x; }
+
+  bar({x: 1});
+  bar({x: 1});
+  for (var i = 0; i < 2; ++i) {
+    %OptimizeFunctionOnNextCall(bar);
+    bar({x: 1});
+    assertOptimized(bar);
+    // Each call below uses a fresh map, so the map check keeps failing at
+    // the same property access.
+    var o = {};
+    o["y" + i] = i;
+    o.x = i;
+    bar(o);
+    assertUnoptimized(bar);
+  }
+
+  %OptimizeFunctionOnNextCall(bar);
+  bar({x: 1});
+  assertOptimized(bar);
+  var o = {z: 0};
+  o.x = 2;
+  assertEquals(2, bar(o));
+  assertOptimized(bar);
+})();
+
@@ -0,0 +1,64 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --turbo-escape
+
+// Loads from a small array literal with a non-constant (but bounds checked)
+// index.
+(function() {
+  function foo(x, i) {
+    const a = [x, x + 1];
+    return a[i];
+  }
+
+  assertEquals(1, foo(1, 0));
+  assertEquals(2, foo(1, 1));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(3, foo(3, 0));
+  assertEquals(4, foo(3, 1));
+  assertEquals(undefined, foo(3, 2));
+})();
+
+(function() {
+  function foo(x, i) {
+    const a = [x, x * 2, x * 3, x * 4];
+    return a[i & 3];
+  }
+
+  assertEquals(2, foo(2, 0));
+  assertEquals(8, foo(2, 3));
+  %OptimizeFunctionOnNextCall(foo);
+  for (let i = 0; i < 4; ++i) assertEquals(5 * (i + 1), foo(5, i));
+})();
+
+// Pairs built in a loop and taken apart with a variable index.
+(function() {
+  function foo(xs) {
+    let s = 0;
+    for (let i = 0; i < xs.length; ++i) {
+      const pair = [xs[i], xs[i] * 10];
+      for (let j = 0; j < 2; ++j) s += pair[j];
+    }
+    return s;
+  }
+
+  assertEquals(33, foo([1, 2]));
+  assertEquals(33, foo([1, 2]));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(66, foo([1, 2, 3]));
+})();
+
+// Elements that hold objects must still be materialized correctly.
+(function() {
+  function foo(x, i) {
+    const o = {x};
+    const a = [o, o];
+    return a[i].x;
+  }
+
+  assertEquals(1, foo(1, 0));
+  assertEquals(1, foo(1, 1));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(2, foo(2, 1));
+})();
@@ -67,4 +67,30 @@ for (var constructor of typedArrayConstructors) {
   var array = new constructor([1, 2, 3, 4, 5, 6, 7, 8, 9, 10]);
   %ArrayBufferNeuter(array.buffer);
   assertThrows(() => array.sort(), TypeError);
+
+  // Large arrays, including NaN and -0 for floats.
+  var large = new constructor(5000);
+  for (var i = 0; i < large.length; i++) {
+    large[i] = (i * 7919) % 5000 - 2500;
+  }
+  var is_float = constructor === Float32Array || constructor === Float64Array;
+  if (is_float) {
+    large[10] = NaN;
+    large[20] = -0;
+    large[30] = NaN;
+    large[40] = +0;
+  }
+  large.sort();
+  for (var i = 1; i < large.length; i++) {
+    var x = large[i - 1];
+    var y = large[i];
+    if (Number.isNaN(y)) continue;
+    assertFalse(Number.isNaN(x));
+    assertTrue(x <= y);
+    if (x === 0 && y === 0) assertFalse(Object.is(x, 0) && Object.is(y, -0));
+  }
+  if (is_float) {
+    assertTrue(Number.isNaN(large[large.length - 1]));
+    assertTrue(Number.isNaN(large[large.length - 2]));
+  }
 }
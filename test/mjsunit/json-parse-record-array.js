@@ -0,0 +1,33 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Give the root map several transitions, so that there is no single
+// expected transition to follow.
+JSON.parse('[{"x": 1}, {"y": 1}, {"z": 1}]');
+
+var records = JSON.parse(
+    '[{"a": 1, "b": "x", "c": 1.5},' +
+    ' {"a": 2, "b": "y", "c": 2.5},' +
+    ' {"a": 3, "c": 3.5, "b": "z"},' +
+    ' {"a": 4, "b": {"nested": true}, "c": null},' +
+    ' {"a": 5, "bb": 1, "c": 2},' +
+    ' {"a": 6},' +
+    ' {"a": 7, "b": "w", "c": 0, "d": []},' +
+    ' {"1": 8, "a": 9}]');
+
+assertEquals([
+  {a: 1, b: "x", c: 1.5},
+  {a: 2, b: "y", c: 2.5},
+  {a: 3, c: 3.5, b: "z"},
+  {a: 4, b: {nested: true}, c: null},
+  {a: 5, bb: 1, c: 2},
+  {a: 6},
+  {a: 7, b: "w", c: 0, d: []},
+  {1: 8, a: 9}], records);
+assertEquals(["a", "c", "b"], Object.keys(records[2]));
+assertEquals(["a", "bb", "c"], Object.keys(records[4]));
+assertTrue(%HaveSameMap(records[0], records[1]));
+assertFalse(%HaveSameMap(records[0], records[2]));
@@ -0,0 +1,44 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Strings of various lengths and alignments, with and without escapes.
+for (var offset = 0; offset < 9; offset++) {
+  var padding = " ".repeat(offset);
+  for (var length = 0; length < 40; length++) {
+    var plain = "x".repeat(length);
+    assertEquals(plain, JSON.parse(padding + '"' + plain + '"'));
+    assertEquals([plain], JSON.parse('[' + padding + '"' + plain + '"]'));
+    var escaped = plain + '\n' + plain + '"' + plain;
+    assertEquals(escaped, JSON.parse(padding + JSON.stringify(escaped)));
+    assertThrows(() => JSON.parse(padding + '"' + plain + '\x01"'),
+                 SyntaxError);
+    assertThrows(() => JSON.parse(padding + '"' + plain), SyntaxError);
+    assertThrows(() => JSON.parse('"' + plain + '\\' + plain + '\x1f"'),
+                 SyntaxError);
+  }
+}
+
+// Non-ASCII one-byte characters don't terminate strings.
+assertEquals("\xe9\xff\x80", JSON.parse('"\xe9\xff\x80"'));
+assertEquals("a\xe9\nb", JSON.parse('"a\xe9\\nb"'));
+
+// Array index keys.
+assertEquals({0: 1, 123: 2, "0123": 3},
+             JSON.parse('{"0": 1, "123": 2, "0123": 3}'));
+
+// Indentation and mixed whitespace.
+assertEquals({a: [1, {b: 2}]},
+             JSON.parse('{\n        "a":\t[ 1,\r\n          {"b"  : 2}  ]  }  '));
+assertThrows(() => JSON.parse('        \x0b1'), SyntaxError);
+
+// Integers of up to 15 digits and beyond.
+assertEquals(123456789, JSON.parse("123456789"));
+assertEquals(1234567890, JSON.parse("1234567890"));
+assertEquals(-1500000000000, JSON.parse("-1500000000000"));
+assertEquals(999999999999999, JSON.parse("999999999999999"));
+assertEquals(-999999999999999, JSON.parse("-999999999999999"));
+assertEquals(1234567890123456789, JSON.parse("1234567890123456789"));
+assertEquals(-0, JSON.parse("-0"));
+assertEquals([1500000000000.5, 15e2],
+             JSON.parse("[1500000000000.5, 15e2]"));
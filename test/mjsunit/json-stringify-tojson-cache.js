@@ -0,0 +1,49 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A toJSON function added to the prototype chain in the middle of
+// serialization is picked up by subsequent objects of the same shape.
+(function() {
+  var records = [{a: 1}, {a: 2}, {a: 3}];
+  var installed = false;
+  Object.defineProperty(records[1], "a", {
+    get: function() {
+      if (!installed) {
+        installed = true;
+        Object.prototype.toJSON = function() { return "replaced"; };
+      }
+      return 2;
+    },
+    enumerable: true
+  });
+  try {
+    assertEquals('[{"a":1},{"a":2},"replaced"]', JSON.stringify(records));
+  } finally {
+    delete Object.prototype.toJSON;
+  }
+})();
+
+// Same for toJSON getters on an intermediate prototype.
+(function() {
+  function Record(x) { this.x = x; }
+  var records = [new Record(1), new Record(2), new Record(3)];
+  var count = 0;
+  Object.defineProperty(Record.prototype, "toJSON", {
+    get: function() { count++; return undefined; },
+    configurable: true
+  });
+  assertEquals('[{"x":1},{"x":2},{"x":3}]', JSON.stringify(records));
+  assertEquals(3, count);
+})();
+
+// Escaping of strings of various lengths.
+(function() {
+  for (var length = 0; length < 40; length++) {
+    var plain = "a".repeat(length);
+    assertEquals('"' + plain + '"', JSON.stringify(plain));
+    assertEquals('"' + plain + '\\n' + plain + '\\"\\\\\\u0001\x7f\xe9"',
+                 JSON.stringify(plain + "\n" + plain + "\"\\\x01\x7f\xe9"));
+  }
+  assertEquals('{"k\\"ey":"α\\t"}', JSON.stringify({"k\"ey": "α\t"}));
+})();
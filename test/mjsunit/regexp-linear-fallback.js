@@ -0,0 +1,44 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-linear-fallback --regexp-backtracks-before-fallback=100
+
+// Regexps that backtrack too much switch to the linear-time engine, which
+// produces the same results.
+
+(function TestCatastrophic() {
+  var re = /(a+)+b/;
+  var subject = "a".repeat(100000) + "c";
+  assertNull(re.exec(subject));
+  assertNull(re.exec(subject));
+  assertEquals(["aaab", "aaa"], re.exec(subject + "aaab").slice());
+})();
+
+(function TestGlobal() {
+  var re = /(x+x+)+y/g;
+  var long = "x".repeat(32);
+  var subject = `${long}y xxy ${long}z xxxy`;
+  assertEquals([`${long}y`, "xxy", "xxxy"], subject.match(re));
+  assertEquals(`[${long}] [xx] ${long}z [xxx]`,
+               subject.replace(re, (m) => `[${m.slice(0, -1)}]`));
+})();
+
+(function TestCaptures() {
+  // Captures inside quantifiers are reset on each iteration.
+  var re = /(?:(a)|(b))+c/;
+  var subject = "ab".repeat(30) + "d" + "abc";
+  assertEquals(["abc", undefined, "b"], re.exec(subject).slice());
+})();
+
+(function TestUnsupported() {
+  // Back references keep backtracking, but still produce results.
+  var re = /(a+)+\1b/;
+  assertNull(re.exec("a".repeat(16) + "c"));
+})();
+
+(function TestDeeplyNested() {
+  // Patterns too deep for the NFA compiler stay with Irregexp.
+  var re = new RegExp("(".repeat(50000) + "a" + ")".repeat(50000));
+  assertThrows(() => re.exec("a"));
+})();
@@ -0,0 +1,58 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --enable-regexp-linear-flag --harmony-regexp-named-captures
+
+// The linear-time engine must produce the same results as Irregexp.
+
+function CheckSameResults(pattern, flags, subjects) {
+  var re = new RegExp(pattern, flags);
+  var linear = new RegExp(pattern, flags + "l");
+  for (var subject of subjects) {
+    re.lastIndex = linear.lastIndex = 0;
+    assertEquals(re.exec(subject), linear.exec(subject), `${re} on ${subject}`);
+    assertEquals(re.lastIndex, linear.lastIndex);
+    assertEquals(subject.replace(re, "[$&]"), subject.replace(linear, "[$&]"));
+    assertEquals(subject.split(re), subject.split(linear));
+  }
+}
+
+var subjects = ["", "a", "abcd", "xxabcdabcd", "aaab\nabab", "foo bar_baz",
+                " ab ", "Āabÿcd"];
+
+CheckSameResults("(a|ab)(c|bcd)(d*)", "", subjects);
+CheckSameResults("(a|ab)(c|bcd)(d*)", "g", subjects);
+CheckSameResults("a*?b", "g", subjects);
+CheckSameResults("(a+)+b", "", subjects);
+CheckSameResults("((a)|b)+", "g", subjects);
+CheckSameResults("(?:a(b)?)+", "", subjects);
+CheckSameResults("^ab|cd$", "gm", subjects);
+CheckSameResults("\\b\\w+\\b", "g", subjects);
+CheckSameResults("\\B.", "g", subjects);
+CheckSameResults("[^a-c\\s]{2,3}", "g", subjects);
+CheckSameResults("[Ā-Ȁ].", "g", subjects);
+CheckSameResults("a{2}|b{1,2}?c?", "g", subjects);
+CheckSameResults(".", "s", subjects);
+CheckSameResults("ab", "y", subjects);
+CheckSameResults("(?<first>a)(?<second>b)?", "g", subjects);
+
+// Named captures are available.
+assertEquals("b", new RegExp("(?<x>b)", "l").exec("ab").groups.x);
+
+// Flags.
+assertEquals("gl", new RegExp("a", "gl").flags);
+
+// Catastrophic backtracking for Irregexp is linear here.
+var subject = "a".repeat(100000) + "c";
+assertNull(new RegExp("(a+)+b", "l").exec(subject));
+assertNull(new RegExp("(a|aa)*b", "l").exec(subject));
+
+// Patterns that need backtracking are rejected.
+assertThrows(() => new RegExp("(a)\\1", "l"), SyntaxError);
+assertThrows(() => new RegExp("(?=a)", "l"), SyntaxError);
+assertThrows(() => new RegExp("(?<=a)b", "l"), SyntaxError);
+assertThrows(() => new RegExp("a.", "il"), SyntaxError);
+assertThrows(() => new RegExp("a.", "ul"), SyntaxError);
+assertThrows(() => new RegExp("(a*)*", "l"), SyntaxError);
+assertThrows(() => new RegExp("a", "ll"), SyntaxError);
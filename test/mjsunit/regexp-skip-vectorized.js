@@ -0,0 +1,49 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Tests the skip loops that look for the characters a match has to start
+// with, which scan many characters at a time on some platforms.
+
+function filler(length, c) {
+  return new Array(length + 1).join(c);
+}
+
+// One-byte and two-byte subjects, with a match at every offset around the
+// vector size and at the very end of the subject.
+for (var two_byte of [false, true]) {
+  var fill = two_byte ? "ሴ" : "-";
+  for (var i = 0; i < 70; i++) {
+    var subject = filler(i, fill) + "needle" + filler(70 - i, fill);
+    assertEquals(i, subject.search(/needle/));
+    assertEquals(i, subject.search(/needle|thread/));
+    assertEquals(i, subject.search(/(?:n|x)eedle/));
+    var tail = filler(i, fill) + "needle";
+    assertEquals(i, tail.search(/needle/));
+    assertEquals(i, tail.search(/[nx]eed/));
+    assertEquals(-1, filler(i, fill).search(/needle/));
+  }
+}
+
+// Characters that only differ above the low seven bits must not be taken
+// for the character looked for.
+var latin1 = filler(100, "é") + "ie" + filler(20, "é");
+assertEquals(100, latin1.search(/ie|ke/));
+var uc16 = filler(100, "ũ") + "iũ" + filler(20, "ũ");
+assertEquals(100, uc16.search(/iũ/));
+var uc16_high = filler(100, "ど") + "ㅩxy";
+assertEquals(100, uc16_high.search(/ㅩxy/));
+
+// Global matching restarts the scan after each match.
+var log = filler(1000, ".") + "ERROR 1" + filler(1000, ".") + "ERROR 2" +
+    filler(10, ".");
+assertEquals(["ERROR 1", "ERROR 2"], log.match(/ERROR \d/g));
+var log16 = "…" + log;
+assertEquals(["ERROR 1", "ERROR 2"], log16.match(/ERROR \d/g));
+
+// Sticky regexps and captures are unaffected.
+var re = /needle(\d)/y;
+re.lastIndex = 3;
+assertNull(re.exec("---" + filler(50, "-") + "needle1"));
+assertEquals(["needle7", "7"],
+             /needle(\d)/.exec(filler(33, "-") + "needle7"));
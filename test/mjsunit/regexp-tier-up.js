@@ -0,0 +1,57 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-tier-up --regexp-tier-up-ticks=3
+
+// Results must not change when a regexp moves from the bytecode interpreter
+// to native code.
+
+function CheckRepeatedly(f, expected) {
+  for (var i = 0; i < 8; i++) assertEquals(expected, f());
+}
+
+(function TestExec() {
+  var re = /(a+)(b*)c/;
+  CheckRepeatedly(() => re.exec("xxaabbcxx").slice(), ["aabbc", "aa", "bb"]);
+  CheckRepeatedly(() => re.exec("xxx"), null);
+})();
+
+(function TestGlobal() {
+  var re = /(\d+)-(\d+)/g;
+  CheckRepeatedly(() => "1-2 33-44 x 5-6".replace(re, "$2:$1"),
+                  "2:1 44:33 x 6:5");
+  CheckRepeatedly(() => "1-2 33-44 x 5-6".match(re), ["1-2", "33-44", "5-6"]);
+  CheckRepeatedly(() => "a1-2b".split(re), ["a", "1", "2", "b"]);
+})();
+
+(function TestSticky() {
+  var re = /foo/y;
+  CheckRepeatedly(() => {
+    re.lastIndex = 3;
+    return re.test("barfoo") && re.lastIndex;
+  }, 6);
+})();
+
+(function TestLastMatchInfo() {
+  var re = /(b)(c)?/;
+  CheckRepeatedly(() => {
+    re.exec("abc");
+    return [RegExp.$1, RegExp.$2, RegExp.lastMatch];
+  }, ["b", "c", "bc"]);
+})();
+
+(function TestBothEncodings() {
+  var re = /[éα]+(x?)$/i;
+  for (var i = 0; i < 8; i++) {
+    assertEquals(["éÉ", ""], re.exec("abéÉ").slice());
+    assertEquals(["αΑx", "x"], re.exec("abαΑx").slice());
+  }
+})();
+
+(function TestBacktrackingLimit() {
+  // Deep backtracking in the interpreter still succeeds.
+  var re = /^(a|ab)*c$/;
+  var subject = "ab".repeat(1000) + "c";
+  CheckRepeatedly(() => re.test(subject), true);
+})();
@@ -0,0 +1,36 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flatten cons strings that were built by repeatedly appending or prepending
+// one-byte and two-byte pieces.
+
+var pieces = ["abcdefghijklmnop", "\u2018quoted\u2019 text", "x",
+              "0123456789012345678901234567890123456789"];
+
+function Check(prepend) {
+  var s = "";
+  var expected = [];
+  for (var i = 0; i < 500; i++) {
+    var piece = pieces[i % pieces.length];
+    if (prepend) {
+      s = piece + s;
+      expected.unshift(piece);
+    } else {
+      s += piece;
+      expected.push(piece);
+    }
+    if (i % 97 == 0) {
+      // Flatten the partial result and keep going.
+      assertEquals(expected.join(""), s);
+    }
+  }
+  var joined = expected.join("");
+  for (var i = 0; i < joined.length; i += 7) {
+    assertEquals(joined.charCodeAt(i), s.charCodeAt(i));
+  }
+  assertEquals(joined, s);
+}
+
+Check(false);
+Check(true);
@@ -0,0 +1,58 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Short patterns whose first character is frequent in the subject, which
+// makes the search switch to comparing the first and last characters of the
+// pattern a word at a time.
+
+function repeat(s, count) {
+  return new Array(count + 1).join(s);
+}
+
+function naiveIndexOf(subject, pattern, start) {
+  for (var i = start; i + pattern.length <= subject.length; i++) {
+    if (subject.startsWith(pattern, i)) return i;
+  }
+  return -1;
+}
+
+var one_byte_patterns = ["ab", "aab", "abab", "aaaab", "aba", "aaaaaa"];
+var two_byte_patterns = ["aሴ", "ሴa", "aaሴb", "ሴሴa", "aaaaaሴ"];
+
+function check(subject, pattern) {
+  for (var start = 0; start < 40; start += 3) {
+    assertEquals(naiveIndexOf(subject, pattern, start),
+                 subject.indexOf(pattern, start), pattern + " " + start);
+  }
+  assertEquals(naiveIndexOf(subject, pattern, 0) != -1,
+               subject.includes(pattern));
+}
+
+for (var length = 0; length < 20; length++) {
+  var prefix = repeat("a", 200 + length);
+  var subjects = [
+    prefix,
+    prefix + "b",
+    prefix + "ba",
+    prefix + "bab" + repeat("a", 20),
+    prefix + "ሴ",
+    prefix + "ሴb" + repeat("a", 20),
+    repeat("aሴ", 100 + length) + "aaaaaaሴ",
+    "ሴ" + prefix + "ab",
+  ];
+  for (var subject of subjects) {
+    for (var pattern of one_byte_patterns) check(subject, pattern);
+    for (var pattern of two_byte_patterns) check(subject, pattern);
+  }
+}
+
+// Patterns that cannot occur in a one-byte subject.
+assertEquals(-1, repeat("a", 100).indexOf("aĀ"));
+// Characters that only differ in their upper byte.
+assertEquals(-1, repeat("Āa", 100).indexOf("aa"));
+assertEquals(199, (repeat("Āa", 100) + "a").indexOf("aa"));
+
+// split uses the same search.
+var parts = (repeat("a", 100) + "ab" + repeat("a", 50) + "ab").split("ab");
+assertEquals([repeat("a", 100), repeat("a", 50), ""], parts);
@@ -0,0 +1,113 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/bounds-check-elimination.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/js-operator.h"
+#include "src/compiler/machine-operator.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/unittests/compiler/graph-unittest.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class BoundsCheckEliminationTest : public TypedGraphTest {
+ public:
+  BoundsCheckEliminationTest()
+      : TypedGraphTest(2),
+        simplified_(zone()),
+        machine_(zone()),
+        javascript_(zone()) {}
+  ~BoundsCheckEliminationTest() override {}
+
+ protected:
+  void Run() {
+    JSGraph jsgraph(isolate(), graph(), common(), javascript(), simplified(),
+                    machine());
+    BoundsCheckElimination elimination(&jsgraph, zone());
+    elimination.Run();
+  }
+
+  // Builds the graph for
+  //
+  //   for (var i = 0; i < limit; ++i) a[CheckBounds(i, length)];
+  //
+  // where {cmp} decides how the loop condition compares i and {limit}, and
+  // returns the CheckBounds node.
+  Node* BuildLoop(const Operator* cmp, Node* limit, Node* length) {
+    Node* const start = graph()->start();
+    Node* const loop = graph()->NewNode(common()->Loop(2), start, start);
+    Node* const effect =
+        graph()->NewNode(common()->EffectPhi(2), start, start, loop);
+    Node* const index =
+        graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2),
+                         NumberConstant(0.0), NumberConstant(0.0), loop);
+    Node* const condition = graph()->NewNode(cmp, index, limit);
+    Node* const branch = graph()->NewNode(common()->Branch(), condition, loop);
+    Node* const if_true = graph()->NewNode(common()->IfTrue(), branch);
+    Node* const check =
+        graph()->NewNode(simplified()->CheckBounds(VectorSlotPair()), index,
+                         length, effect, if_true);
+    Node* const increment =
+        graph()->NewNode(simplified()->NumberAdd(), index, NumberConstant(1.0));
+    loop->ReplaceInput(1, if_true);
+    effect->ReplaceInput(1, check);
+    index->ReplaceInput(1, increment);
+    Node* const if_false = graph()->NewNode(common()->IfFalse(), branch);
+    Node* const ret = graph()->NewNode(common()->Return(), NumberConstant(0.0),
+                                       index, effect, if_false);
+    graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+
+    // This is what the typer figures out for the induction variable.
+    Type* const index_type = Type::Range(0.0, kMaxInt, zone());
+    NodeProperties::SetType(index, index_type);
+    NodeProperties::SetType(increment, index_type);
+    NodeProperties::SetType(check, Type::Range(0.0, kMaxInt - 1, zone()));
+    return check;
+  }
+
+  JSOperatorBuilder* javascript() { return &javascript_; }
+  MachineOperatorBuilder* machine() { return &machine_; }
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+ private:
+  SimplifiedOperatorBuilder simplified_;
+  MachineOperatorBuilder machine_;
+  JSOperatorBuilder javascript_;
+};
+
+TEST_F(BoundsCheckEliminationTest, LoopBoundedByLength) {
+  Node* const length = Parameter(Type::Range(0.0, kMaxInt, zone()), 0);
+  Node* const check = BuildLoop(simplified()->NumberLessThan(), length, length);
+  Node* const index = check->InputAt(0);
+  Run();
+  EXPECT_EQ(IrOpcode::kTypeGuard, check->opcode());
+  EXPECT_EQ(index, check->InputAt(0));
+  EXPECT_TRUE(NodeProperties::GetType(check)->Is(
+      Type::Range(0.0, kMaxInt - 1, zone())));
+}
+
+TEST_F(BoundsCheckEliminationTest, LoopBoundedByOtherValue) {
+  Node* const limit = Parameter(Type::Range(0.0, kMaxInt, zone()), 0);
+  Node* const length = Parameter(Type::Range(0.0, kMaxInt, zone()), 1);
+  Node* const check = BuildLoop(simplified()->NumberLessThan(), limit, length);
+  Run();
+  EXPECT_EQ(IrOpcode::kCheckBounds, check->opcode());
+  EXPECT_EQ(length, check->InputAt(1));
+}
+
+TEST_F(BoundsCheckEliminationTest, LoopBoundedByLengthInclusive) {
+  Node* const length = Parameter(Type::Range(0.0, kMaxInt, zone()), 0);
+  Node* const check =
+      BuildLoop(simplified()->NumberLessThanOrEqual(), length, length);
+  Run();
+  EXPECT_EQ(IrOpcode::kCheckBounds, check->opcode());
+  EXPECT_EQ(length, check->InputAt(1));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,66 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/js-inlining-heuristic.h"
+#include "src/compiler/js-operator.h"
+#include "test/unittests/compiler/graph-unittest.h"
+#include "test/unittests/test-utils.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class JSInliningHeuristicTest : public GraphTest {
+ public:
+  JSInliningHeuristicTest() : GraphTest(0) {}
+
+ protected:
+  typedef JSInliningHeuristic::Candidate Candidate;
+
+  // Every candidate gets its own call site, so that the node ids of
+  // candidates created later are larger.
+  Candidate NewCandidate(CallFrequency frequency, int total_size) {
+    Candidate candidate;
+    candidate.num_functions = 0;
+    candidate.node = graph()->NewNode(common()->Dead());
+    candidate.frequency = frequency;
+    candidate.total_size = total_size;
+    return candidate;
+  }
+
+  // Whether {left} is inlined before {right}.
+  static bool IsBefore(const Candidate& left, const Candidate& right) {
+    return JSInliningHeuristic::CandidateCompare()(left, right);
+  }
+};
+
+TEST_F(JSInliningHeuristicTest, FrequencyRanking) {
+  Candidate big = NewCandidate(CallFrequency(2.0f), 100);
+  Candidate small = NewCandidate(CallFrequency(1.0f), 10);
+  EXPECT_TRUE(IsBefore(big, small));
+  EXPECT_FALSE(IsBefore(small, big));
+}
+
+TEST_F(JSInliningHeuristicTest, UnknownFrequencyFirst) {
+  Candidate known = NewCandidate(CallFrequency(1.0f), 1);
+  Candidate unknown1 = NewCandidate(CallFrequency(), 100);
+  Candidate unknown2 = NewCandidate(CallFrequency(), 100);
+  EXPECT_TRUE(IsBefore(unknown1, known));
+  EXPECT_FALSE(IsBefore(known, unknown1));
+  // Unknown frequencies are ordered by node id.
+  EXPECT_TRUE(IsBefore(unknown2, unknown1));
+  EXPECT_FALSE(IsBefore(unknown1, unknown2));
+}
+
+TEST_F(JSInliningHeuristicTest, EqualFrequencyTiesBrokenByNodeId) {
+  Candidate first = NewCandidate(CallFrequency(1.0f), 10);
+  Candidate second = NewCandidate(CallFrequency(1.0f), 20);
+  EXPECT_TRUE(IsBefore(second, first));
+  EXPECT_FALSE(IsBefore(first, second));
+  EXPECT_FALSE(IsBefore(first, first));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
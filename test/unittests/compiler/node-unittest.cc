@@ -166,6 +166,25 @@ TEST_F(NodeTest, AppendInput) {
 }
 
 
+TEST_F(NodeTest, AppendInputBeyondInlineSlack) {
+  Node* n0 = Node::New(zone(), 0, &kOp0, 0, nullptr, false);
+  Node* n1 = Node::New(zone(), 1, &kOp1, 1, &n0, false);
+  Node* inputs[] = {n0, n1};
+  Node* node = Node::New(zone(), 12345, &kOp0, 2, inputs, true);
+  EXPECT_THAT(node->inputs(), ElementsAre(n0, n1));
+  node->AppendInput(zone(), n1);
+  EXPECT_THAT(node->inputs(), ElementsAre(n0, n1, n1));
+  // Eventually the inputs no longer fit inline and move out of line.
+  for (int i = 0; i < 20; i++) node->AppendInput(zone(), n0);
+  EXPECT_EQ(23, node->InputCount());
+  EXPECT_EQ(n0, node->InputAt(0));
+  EXPECT_EQ(n1, node->InputAt(1));
+  EXPECT_EQ(n1, node->InputAt(2));
+  EXPECT_EQ(n0, node->InputAt(22));
+  EXPECT_EQ(22, n0->UseCount());
+  EXPECT_EQ(2, n1->UseCount());
+}
+
 TEST_F(NodeTest, TrimThenAppend) {
   Node* n0 = Node::New(zone(), 0, &kOp0, 0, nullptr, false);
   Node* n1 = Node::New(zone(), 1, &kOp0, 0, nullptr, false);
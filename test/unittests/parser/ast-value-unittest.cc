@@ -2,6 +2,9 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <string>
+#include <vector>
+
 #include "src/ast/ast-value-factory.h"
 #include "src/ast/ast.h"
 #include "src/heap/heap-inl.h"
@@ -47,5 +50,25 @@ TEST_F(AstValueTest, BigIntToBooleanIsTrue) {
   EXPECT_TRUE(NewBigInt("0x0000D00C0")->ToBooleanIsTrue());
 }
 
+TEST_F(AstValueTest, InternalizeManyStrings) {
+  // More strings than the string table has room for, some of which are
+  // internalized already.
+  const int kCount = 3 * StringTable::kMinCapacity;
+  std::vector<const AstRawString*> strings;
+  for (int i = 0; i < kCount; i++) {
+    std::string name =
+        (i % 16 == 0) ? "length" : "internalize_" + std::to_string(i);
+    strings.push_back(ast_value_factory_.GetOneByteString(name.c_str()));
+  }
+  ast_value_factory_.Internalize(i_isolate());
+
+  for (int i = 0; i < kCount; i++) {
+    Handle<String> string = strings[i]->string();
+    EXPECT_TRUE(string->IsInternalizedString());
+    EXPECT_EQ(*string, *i_isolate()->factory()->InternalizeString(string));
+    EXPECT_TRUE(strings[i]->IsOneByteEqualTo(string->ToCString().get()));
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -114,6 +114,38 @@ TEST(UnicodeTest, SurrogateOverrunsBuffer) {
   CHECK_EQ(output_utf16[0], 0x00);
 }
 
+TEST(UnicodeTest, AsciiRunsBetweenMultiByteSequences) {
+  // ASCII runs of all lengths around the word size, followed by a two byte
+  // sequence, an invalid byte and a surrogate pair that may straddle the
+  // end of the decoder's buffer.
+  for (size_t ascii_length = 0; ascii_length < 40; ascii_length++) {
+    std::vector<byte> bytes(ascii_length, 'a');
+    std::vector<unibrow::uchar> expected(ascii_length, 'a');
+    for (byte b : {0xC3, 0xA9, 0x62, 0xFF, 0x63, 0xF0, 0x9F, 0x98, 0x80}) {
+      bytes.push_back(b);
+    }
+    for (unibrow::uchar c : {0xE9, 0x62, 0xFFFD, 0x63, 0x1F600}) {
+      expected.push_back(c);
+    }
+    bytes.insert(bytes.end(), ascii_length, 'z');
+    expected.insert(expected.end(), ascii_length, 'z');
+
+    std::vector<unibrow::uchar> output;
+    DecodeNormally(bytes, &output);
+    CHECK(output == expected);
+
+    unibrow::Utf8Decoder<8> small_decoder;
+    output.clear();
+    DecodeUtf16(&small_decoder, bytes, &output);
+    CHECK(output == expected);
+
+    unibrow::Utf8Decoder<64> large_decoder;
+    output.clear();
+    DecodeUtf16(&large_decoder, bytes, &output);
+    CHECK(output == expected);
+  }
+}
+
 TEST(UnicodeTest, IncrementalUTF8DecodingVsNonIncrementalUtf8Decoding) {
   // Unfortunately, V8 has two UTF-8 decoders. This test checks that they
   // produce the same result. This test was inspired by
@@ -109,5 +109,27 @@ TYPED_TEST(UtilsTest, SaturateAdd) {
   }
 }
 
+TEST(UtilsTest, AsciiPrefixLength) {
+  uint8_t bytes[64];
+  for (size_t i = 0; i < arraysize(bytes); ++i) bytes[i] = 'a';
+  for (size_t start = 0; start < 16; ++start) {
+    for (size_t length = 0; start + length <= arraysize(bytes); ++length) {
+      EXPECT_EQ(length, AsciiPrefixLength(bytes + start, length));
+    }
+  }
+  for (size_t non_ascii = 0; non_ascii < arraysize(bytes); ++non_ascii) {
+    bytes[non_ascii] = 0x80;
+    for (size_t start = 0; start <= non_ascii; ++start) {
+      size_t length = arraysize(bytes) - start;
+      size_t prefix = AsciiPrefixLength(bytes + start, length);
+      // The prefix is all ASCII and stops at most one word before the
+      // non-ASCII byte.
+      EXPECT_LE(prefix, non_ascii - start);
+      EXPECT_LT(non_ascii - start, prefix + sizeof(uintptr_t));
+    }
+    bytes[non_ascii] = 'a';
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -21,12 +21,30 @@ TEST(Zone, SegmentPoolConstraints) {
     size_t total_size = 0;
     for (size_t power = 0; power < AccountingAllocator::kNumberBuckets;
          ++power) {
-      total_size +=
-          allocator.unused_segments_max_sizes_[power] * (size_t(1) << power);
+      size_t segment_size =
+          size_t(1) << (power + AccountingAllocator::kMinSegmentSizePower);
+      total_size += allocator.unused_segments_max_sizes_[power] * segment_size;
     }
     EXPECT_LE(total_size, size);
   }
 }
 
+TEST(Zone, SegmentPoolReusesLargeSegments) {
+  AccountingAllocator allocator;
+  allocator.ConfigureSegmentPool(AccountingAllocator::kMaxPoolSize);
+
+  Segment* segment = allocator.GetSegment(1 * MB);
+  ASSERT_NE(nullptr, segment);
+  EXPECT_FALSE(segment->reused());
+  allocator.ReturnSegment(segment);
+  EXPECT_EQ(1 * MB, allocator.GetCurrentPoolSize());
+
+  Segment* reused = allocator.GetSegment(1 * MB);
+  EXPECT_EQ(segment, reused);
+  EXPECT_TRUE(reused->reused());
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+  allocator.ReturnSegment(reused);
+}
+
 }  // namespace internal
 }  // namespace v8
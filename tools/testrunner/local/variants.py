@@ -15,6 +15,10 @@ ALL_VARIANT_FLAGS = {
   # would not force optimization too. It turns into a Nop. Please see
   # https://chromium-review.googlesource.com/c/452620/ for more discussion.
   "nooptimization": [["--noopt"]],
+  # Hand every regexp the linear-time engine can match over to it after its
+  # first backtrack.
+  "regexp_linear_fallback": [["--regexp-linear-fallback",
+                              "--regexp-backtracks-before-fallback=1"]],
   "slow_path": [["--force-slow-path"]],
   "stress": [["--stress-opt", "--always-opt"]],
   "stress_background_compile": [["--stress-background-compile"]],